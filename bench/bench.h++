@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sys/resource.h>
+
+namespace nutsloop::args::bench {
+
+// Heap allocations made through operator new so far; counted by the
+// replacement operators in bench_alloc.c++, linked into every benchmark.
+std::size_t allocation_count() noexcept;
+
+// Keeps the optimizer from discarding a value computed inside a timed loop.
+template <typename T> inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Peak resident set size of the process so far, in KiB.
+inline long peak_rss_kib() noexcept {
+  rusage usage{};
+  ::getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1024; // bytes on macOS
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+struct result_t {
+  std::string name;
+  std::size_t iterations{0};
+  double ns_per_op{0.0};
+  double allocations_per_op{0.0};
+  long peak_rss_kib{0};
+};
+
+// Runs `fn` `iterations` times after a short warm-up and reports the mean cost
+// of one call in nanoseconds and heap allocations, plus the peak RSS after.
+template <typename Fn> result_t run(std::string_view name, std::size_t iterations, Fn &&fn) {
+  for (std::size_t i = 0; i < iterations / 10 + 1; ++i) {
+    fn();
+  }
+
+  const auto allocations = allocation_count();
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < iterations; ++i) {
+    fn();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const auto allocated = allocation_count() - allocations;
+
+  const auto ns = std::chrono::duration<double, std::nano>(elapsed).count();
+  return {std::string(name), iterations, ns / static_cast<double>(iterations),
+          static_cast<double>(allocated) / static_cast<double>(iterations), peak_rss_kib()};
+}
+
+namespace detail {
+inline std::vector<result_t> &reported() {
+  static std::vector<result_t> results;
+  return results;
+}
+} // namespace detail
+
+inline void report(const result_t &result) {
+  std::printf("%-48s %14.1f ns/op %10.1f allocs/op %12zu iterations\n", result.name.c_str(),
+              result.ns_per_op, result.allocations_per_op, result.iterations);
+  detail::reported().push_back(result);
+}
+
+/**
+ * Prints the peak RSS of the suite and, when the benchmark was started with
+ * `--json=<path>`, writes every reported result there so runs can be
+ * compared between releases:
+ *
+ * {"suite": "...", "peak_rss_kib": N, "results": [{"name": "...",
+ *   "iterations": N, "ns_per_op": X, "allocations_per_op": X,
+ *   "peak_rss_kib": N}, ...]}
+ *
+ * Returns the process exit code.
+ */
+inline int finish(const std::string_view suite, const int argc, char *argv[]) {
+  const long peak = peak_rss_kib();
+  const std::string name = std::string(suite) + "/peak_rss";
+  std::printf("%-48s %14ld KiB peak RSS\n", name.c_str(), peak);
+
+  std::string_view path;
+  for (int i = 1; i < argc; ++i) {
+    if (const std::string_view arg = argv[i]; arg.starts_with("--json=")) {
+      path = arg.substr(7);
+    }
+  }
+  if (path.empty()) {
+    return 0;
+  }
+
+  std::FILE *file = std::fopen(std::string(path).c_str(), "w");
+  if (file == nullptr) {
+    std::fprintf(stderr, "cannot write %s\n", std::string(path).c_str());
+    return 1;
+  }
+
+  // benchmark names are plain ASCII paths and need no JSON escaping.
+  std::fprintf(file, "{\"suite\": \"%.*s\", \"peak_rss_kib\": %ld, \"results\": [",
+               static_cast<int>(suite.size()), suite.data(), peak);
+  const auto &results = detail::reported();
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const auto &result = results[i];
+    std::fprintf(file,
+                 "%s{\"name\": \"%s\", \"iterations\": %zu, \"ns_per_op\": %.3f, "
+                 "\"allocations_per_op\": %.3f, \"peak_rss_kib\": %ld}",
+                 i == 0 ? "\n  " : ",\n  ", result.name.c_str(), result.iterations,
+                 result.ns_per_op, result.allocations_per_op, result.peak_rss_kib);
+  }
+  std::fputs("\n]}\n", file);
+  std::fclose(file);
+  return 0;
+}
+
+// Owns a synthetic argv so benchmarks can hand out `char *argv[]` repeatedly.
+struct argv_t {
+  std::vector<std::string> storage;
+  std::vector<char *> ptrs;
+
+  explicit argv_t(std::vector<std::string> args) : storage(std::move(args)) {
+    for (auto &s : storage) {
+      ptrs.push_back(s.data());
+    }
+    ptrs.push_back(nullptr);
+  }
+
+  [[nodiscard]] int argc() const { return static_cast<int>(storage.size()); }
+  [[nodiscard]] char **argv() { return ptrs.data(); }
+};
+
+} // namespace nutsloop::args::bench
@@ -0,0 +1,92 @@
+// Batch-parsing job command lines: 1M lines through one reused sequencer on
+// a single thread against parse_batch() on 1, 2, 4 ... hardware_concurrency
+// threads, reporting lines per second and the speedup over one thread. Pass
+// `--json=<path>` to record the results.
+
+#include "args.h++"
+#include "args/batch.h++"
+#include "bench.h++"
+
+#include <cstdio>
+#include <format>
+#include <string_view>
+#include <thread>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+using sequencer_t = args::sequencer<checker_t>;
+
+constexpr std::size_t line_count = 1000000;
+
+// 64 distinct command lines of a scheduler's job log, repeated to line_count.
+struct lines_t {
+  std::vector<bench::argv_t> distinct;
+  std::vector<std::span<const char *const>> lines;
+
+  lines_t() {
+    for (std::size_t i = 0; i < 64; ++i) {
+      distinct.emplace_back(std::vector<std::string>{
+          "job", i % 3 == 0 ? "build" : "test", std::format("--id={}", 4000 + i),
+          std::format("--timeout={}s", 30 + i % 7), std::format("--queue=queue-{}", i % 5),
+          i % 2 == 0 ? "--enable-cache" : "--disable-cache", std::format("--ratio=0.{}", i % 9)});
+    }
+    lines.reserve(line_count);
+    for (std::size_t i = 0; i < line_count; ++i) {
+      auto &argv = distinct[i % distinct.size()];
+      lines.emplace_back(const_cast<const char *const *>(argv.argv()),
+                         static_cast<std::size_t>(argv.argc()));
+    }
+  }
+};
+
+double report_throughput(const std::string_view name, const bench::result_t &result,
+                         const double baseline) {
+  bench::report(result);
+  const double lines_per_s = 1e9 * line_count / result.ns_per_op;
+  std::printf("%-48s %14.0f lines/s %6.2fx\n", std::format("{}/throughput", name).c_str(),
+              lines_per_s, baseline > 0 ? lines_per_s / baseline : 1.0);
+  return lines_per_s;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  const lines_t input;
+
+  sequencer_t parser;
+  const double sequential = report_throughput(
+      "batch/sequential", bench::run("batch/sequential", 1, [&] {
+        std::size_t values = 0;
+        for (const auto line : input.lines) {
+          parser.parse(line);
+          values += parser.get_args().size();
+        }
+        bench::do_not_optimize(values);
+      }),
+      0);
+
+  const std::size_t max_threads = std::max(1U, std::thread::hardware_concurrency());
+  double single = 0;
+  for (std::size_t threads = 1;; threads = std::min(threads * 2, max_threads)) {
+    const auto name = std::format("batch/parse_batch/{}_threads", threads);
+    const auto result = bench::run(name, 1, [&] {
+      const auto batch = args::parse_batch<sequencer_t>(input.lines, {.threads = threads});
+      bench::do_not_optimize(batch.size());
+    });
+    const auto lines_per_s = report_throughput(name, result, threads == 1 ? 0 : single);
+    if (threads == 1) {
+      single = lines_per_s;
+      std::printf("%-48s %14.2fx\n", "batch/parse_batch/1_threads/vs_sequential",
+                  lines_per_s / sequential);
+    }
+    if (threads == max_threads) {
+      break;
+    }
+  }
+
+  return bench::finish("batch", argc, argv);
+}
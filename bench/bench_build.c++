@@ -0,0 +1,158 @@
+// Compile time of a translation unit that uses a sequencer: including
+// args.h++ and instantiating the parser in place, against including
+// args/extern_sequencer.h++ and linking to the copy compiled into args_lib,
+// and against `import nutsloop.args;` when the compiler can build the
+// module. Each case compiles a generated source file with the compiler the
+// project was configured with. Arguments: `--cxx=<compiler>`,
+// `--cxx-id=<gcc|clang>`, `--include=<dir>`, any number of `--flag=<flag>`,
+// and `--json=<path>` to record the results.
+
+#include "bench.h++"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+namespace bench = nutsloop::args::bench;
+namespace fs = std::filesystem;
+
+constexpr std::size_t compiles = 4;
+
+struct options_t {
+  std::string cxx{"c++"};
+  std::string cxx_id{"gcc"};
+  std::string include{"include"};
+  std::string flags;
+};
+
+options_t read_options(const int argc, char *argv[]) {
+  options_t options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg.starts_with("--cxx=")) {
+      options.cxx = arg.substr(6);
+    } else if (arg.starts_with("--cxx-id=")) {
+      options.cxx_id = arg.substr(9);
+    } else if (arg.starts_with("--include=")) {
+      options.include = arg.substr(10);
+    } else if (arg.starts_with("--flag=")) {
+      options.flags += std::format(" {}", arg.substr(7));
+    }
+  }
+  // compiles run from a scratch directory.
+  options.include = fs::absolute(options.include).string();
+  return options;
+}
+
+// What a typical user of the library compiles: a sequencer built from argv
+// and read through the common getters.
+std::string user_source(const std::string_view preamble) {
+  return std::format(R"({}
+
+namespace args = nutsloop::args;
+
+int run(int argc, char *argv[]) {{
+  args::sequencer<args::args_key_value_t_> parser(argc, argv);
+  auto name = parser.get_option_string("name");
+  auto verbose = parser.get_option_bool("verbose");
+  auto port = parser.get_arg<unsigned long long>("port");
+  return static_cast<int>(parser.get_args().size() + name.index() + verbose.index() +
+                          port.value_or(0) + parser.has("dry-run"));
+}}
+)",
+                     preamble);
+}
+
+void write_file(const fs::path &path, const std::string &text) {
+  std::ofstream(path) << text;
+}
+
+bool compile(const options_t &options, const std::string &arguments) {
+  const auto command = std::format("{} -std=c++23 -O2{} -I{} {} > /dev/null 2>&1", options.cxx,
+                                   options.flags, options.include, arguments);
+  return std::system(command.c_str()) == 0;
+}
+
+// Times `compiles` compilations of `source` in `dir`, or nothing when the
+// first one fails.
+std::optional<bench::result_t> time_compile(const std::string_view name, const options_t &options,
+                                            const fs::path &dir, const std::string &source,
+                                            const std::string &arguments) {
+  const auto path = dir / "user.c++";
+  write_file(path, source);
+  const auto command = std::format("{} -c {} -o {}", arguments, path.string(),
+                                   (dir / "user.o").string());
+  if (!compile(options, command)) {
+    return std::nullopt;
+  }
+  return bench::run(name, compiles, [&] { bench::do_not_optimize(compile(options, command)); });
+}
+
+void report_against(const bench::result_t &result, const double baseline) {
+  bench::report(result);
+  std::printf("%-48s %14.2fx\n", std::format("{}/vs_header_only", result.name).c_str(),
+              baseline / result.ns_per_op);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  const auto options = read_options(argc, argv);
+  const auto dir = fs::temp_directory_path() / std::format("nutsloop_args_build_{}", ::getpid());
+  fs::create_directories(dir);
+
+  const auto header_only =
+      time_compile("build/compile_tu/header_only", options, dir,
+                   user_source("#include \"args.h++\""), "");
+  if (!header_only) {
+    std::fprintf(stderr, "%s cannot compile args.h++\n", options.cxx.c_str());
+    fs::remove_all(dir);
+    return 1;
+  }
+  bench::report(*header_only);
+
+  if (const auto extern_template =
+          time_compile("build/compile_tu/extern_template", options, dir,
+                       user_source("#include \"args/extern_sequencer.h++\""), "")) {
+    report_against(*extern_template, header_only->ns_per_op);
+  }
+
+  // the module interface is built once, as a build system would, then
+  // imported by the user source.
+  const auto interface = fs::path(options.include) / "args.c++m";
+  const bool clang = options.cxx_id.starts_with("clang");
+  const auto module_flags =
+      clang ? std::format("-fprebuilt-module-path={}", dir.string()) : std::string("-fmodules-ts");
+  const auto interface_command =
+      clang ? std::format("-x c++-module --precompile {} -o {}", interface.string(),
+                          (dir / "nutsloop.args.pcm").string())
+            : std::format("-fmodules-ts -x c++ -c {} -o {}", interface.string(),
+                          (dir / "args_module.o").string());
+  const auto previous = fs::current_path();
+  fs::current_path(dir); // GCC keeps compiled module interfaces in ./gcm.cache
+  if (compile(options, interface_command)) {
+    if (const auto module =
+            time_compile("build/compile_tu/import_module", options, dir,
+                         user_source("import nutsloop.args;"), module_flags)) {
+      report_against(*module, header_only->ns_per_op);
+    } else {
+      std::printf("%-48s %14s\n", "build/compile_tu/import_module", "skipped");
+    }
+  } else {
+    std::printf("%-48s %14s\n", "build/compile_tu/import_module", "skipped");
+  }
+  fs::current_path(previous);
+
+  fs::remove_all(dir);
+  return bench::finish("build", argc, argv);
+}
@@ -0,0 +1,107 @@
+// Subcommand dispatch for a tool with 40 subcommands, each with its own
+// skip_digit_check, list_keys and switches: one sequencer configured with
+// the options of every command, built per invocation, against a
+// command_tree built per invocation (only the selected command's options
+// and sequencer are built) and a reused one; then the perfect-hash lookup of
+// one command name against std::unordered_map. Pass `--json=<path>` to
+// record the results.
+
+#include "args.h++"
+#include "args/command_tree.h++"
+#include "bench.h++"
+
+#include <format>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+using sequencer_t = args::sequencer<checker_t>;
+
+constexpr std::size_t command_count = 40;
+
+std::string command_name(const std::size_t i) { return std::format("command-{}", i); }
+
+args::command_options_t command_options(const std::size_t i) {
+  args::command_options_t options{.skip_digit_check = std::unordered_set<std::string>{},
+                                  .list_keys = std::unordered_set<std::string>{},
+                                  .switches = std::vector<std::string>{}};
+  for (std::size_t k = 0; k < 8; ++k) {
+    options.skip_digit_check->insert(std::format("{}-id-{}", command_name(i), k));
+    options.list_keys->insert(std::format("{}-list-{}", command_name(i), k));
+    options.switches->push_back(std::format("{}-feature-{}", command_name(i), k));
+  }
+  return options;
+}
+
+// What a single sequencer needs when it has to accept every command.
+args::command_options_t all_command_options() {
+  args::command_options_t all{.skip_digit_check = std::unordered_set<std::string>{},
+                              .list_keys = std::unordered_set<std::string>{},
+                              .switches = std::vector<std::string>{}};
+  for (std::size_t i = 0; i < command_count; ++i) {
+    auto options = command_options(i);
+    all.skip_digit_check->merge(*options.skip_digit_check);
+    all.list_keys->merge(*options.list_keys);
+    all.switches->insert(all.switches->end(), options.switches->begin(), options.switches->end());
+  }
+  return all;
+}
+
+void add_commands(args::command_tree<sequencer_t> &tree) {
+  for (std::size_t i = 0; i < command_count; ++i) {
+    tree.add(command_name(i), [i] { return command_options(i); });
+  }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  bench::argv_t invocation({"tool", "command-23", "--command-23-id-1=0042",
+                            "--command-23-list-2=a,b,c", "--enable-command-23-feature-3",
+                            "--threads=8"});
+
+  bench::report(bench::run("commands/flat/construct", 2000, [&] {
+    const auto options = all_command_options();
+    sequencer_t parser(invocation.argc(), invocation.argv(), options.skip_digit_check,
+                       options.version, options.list_keys, options.switches);
+    bench::do_not_optimize(parser.get_args().size());
+  }));
+
+  bench::report(bench::run("commands/tree/construct", 2000, [&] {
+    args::command_tree<sequencer_t> tree;
+    add_commands(tree);
+    auto &parser = tree.parse(invocation.argc(), invocation.argv());
+    bench::do_not_optimize(parser.get_args().size());
+  }));
+
+  args::command_tree<sequencer_t> tree;
+  add_commands(tree);
+  bench::report(bench::run("commands/tree/reparse", 200000, [&] {
+    auto &parser = tree.parse(invocation.argc(), invocation.argv());
+    bench::do_not_optimize(parser.get_args().size());
+  }));
+
+  std::vector<std::string> names;
+  std::unordered_map<std::string, std::size_t, args::args_hash_t, std::equal_to<>> by_name;
+  for (std::size_t i = 0; i < command_count; ++i) {
+    names.push_back(command_name(i));
+    by_name.emplace(names.back(), i);
+  }
+  args::detail::command_index_t index;
+  index.build(names);
+  const std::string_view token = "command-23";
+  bench::report(bench::run("commands/dispatch/perfect_hash", 10000000, [&] {
+    bench::do_not_optimize(index.find(token));
+  }));
+  bench::report(bench::run("commands/dispatch/unordered_map", 10000000, [&] {
+    bench::do_not_optimize(by_name.find(token)->second);
+  }));
+
+  return bench::finish("commands", argc, argv);
+}
@@ -0,0 +1,131 @@
+// Command-line joining for job logs: the former filter | transform |
+// join_with pipeline (or append loop) against the single-buffer join, a join
+// into a reused string and into a caller-provided span, and write_joined()
+// streaming to /dev/null against joining first and writing the string.
+
+#include "args.h++"
+#include "bench.h++"
+
+#include <fcntl.h>
+#include <format>
+#include <ranges>
+#include <unistd.h>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+using sequencer_t = args::sequencer<checker_t>;
+
+// argv_to_string_ranges_ before the join was measured first: the join_with
+// pipeline where the standard library has it, one append per argument
+// otherwise.
+std::string former_join(const int argc, char *argv[], const char separator) {
+  if (argc <= 1) {
+    return "";
+  }
+#if defined(__cpp_lib_ranges_join_with)
+  auto joined_view = std::span(argv + 1, argc - 1) |
+                     std::views::filter([](const char *s) { return s != nullptr; }) |
+                     std::views::transform([](const char *s) { return std::string_view(s); }) |
+                     std::views::join_with(separator);
+  return std::ranges::to<std::string>(joined_view);
+#else
+  std::string result;
+  for (int i = 1; i < argc; ++i) {
+    if (argv[i] == nullptr) {
+      continue;
+    }
+    if (!result.empty()) {
+      result += separator;
+    }
+    result += argv[i];
+  }
+  return result;
+#endif
+}
+
+struct shape_t {
+  std::string name;
+  bench::argv_t argv;
+  std::size_t iterations;
+};
+
+std::vector<shape_t> make_shapes() {
+  std::vector<shape_t> shapes;
+
+  shapes.push_back({"few_flags",
+                    bench::argv_t({"prog", "serve", "--verbose", "--port=8080", "--host=localhost"}),
+                    1000000});
+
+  std::vector<std::string> many{"prog", "build"};
+  for (std::size_t i = 0; i < 200; ++i) {
+    many.push_back(std::format("--option-{}=value-{}", i, i));
+  }
+  shapes.push_back({"many_flags", bench::argv_t(std::move(many)), 50000});
+
+  std::vector<std::string> long_values{"prog"};
+  for (std::size_t i = 0; i < 16; ++i) {
+    const std::string value(4096, static_cast<char>('a' + i));
+    long_values.push_back(std::format("--path-{}={}", i, value));
+  }
+  shapes.push_back({"long_values", bench::argv_t(std::move(long_values)), 20000});
+
+  std::vector<std::string> huge{"prog"};
+  for (std::size_t i = 0; i < 100000; ++i) {
+    huge.push_back(std::format("/srv/jobs/input/part-{:06}.dat", i));
+  }
+  shapes.push_back({"100k_args", bench::argv_t(std::move(huge)), 100});
+
+  return shapes;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  auto shapes = make_shapes();
+  const int null_fd = ::open("/dev/null", O_WRONLY | O_CLOEXEC);
+
+  for (auto &shape : shapes) {
+    const int join_argc = shape.argv.argc();
+    char **join_argv = shape.argv.argv();
+    const std::span<char *const> parts(join_argv + 1, join_argc - 1);
+
+    bench::report(bench::run(std::format("join/former/{}", shape.name), shape.iterations, [&] {
+      bench::do_not_optimize(former_join(join_argc, join_argv, '|').size());
+    }));
+    bench::report(bench::run(std::format("join/measured/{}", shape.name), shape.iterations, [&] {
+      bench::do_not_optimize(sequencer_t::argv_to_string_ranges_(join_argc, join_argv).size());
+    }));
+
+    std::string reused;
+    bench::report(bench::run(std::format("join/reused_string/{}", shape.name), shape.iterations,
+                             [&] {
+                               args::join(join_argv + 1, join_argc - 1, reused, '|');
+                               bench::do_not_optimize(reused.size());
+                             }));
+
+    std::vector<char> buffer(args::joined_size(parts));
+    bench::report(bench::run(std::format("join/span/{}", shape.name), shape.iterations, [&] {
+      bench::do_not_optimize(
+          sequencer_t::argv_to_string_ranges_(join_argc, join_argv, std::span<char>(buffer)));
+    }));
+
+    bench::report(bench::run(std::format("join/fd/join_then_write/{}", shape.name),
+                             shape.iterations, [&] {
+                               const auto joined =
+                                   sequencer_t::argv_to_string_ranges_(join_argc, join_argv);
+                               bench::do_not_optimize(
+                                   ::write(null_fd, joined.data(), joined.size()));
+                             }));
+    bench::report(bench::run(std::format("join/fd/write_joined/{}", shape.name),
+                             shape.iterations, [&] {
+                               bench::do_not_optimize(args::write_joined(null_fd, parts, '|'));
+                             }));
+  }
+
+  ::close(null_fd);
+  return bench::finish("join", argc, argv);
+}
@@ -0,0 +1,87 @@
+// Numeric detection on numeric-heavy argument vectors: the single-pass
+// parse_ull_ against the former isdigit / to_string(ULLONG_MAX) / from_chars
+// chain, and a full parse of `--shard-0=... --shard-9999=...`.
+
+#include "args.h++"
+#include "bench.h++"
+
+#include <algorithm>
+#include <cctype>
+#include <format>
+#include <limits>
+#include <optional>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+
+// The three passes numeric detection used before parse_ull_.
+std::optional<unsigned long long> three_pass_ull(const std::string_view value) {
+  if (value.empty() || !std::all_of(value.begin(), value.end(),
+                                    [](const unsigned char c) { return std::isdigit(c); })) {
+    return std::nullopt;
+  }
+  static const std::string max_value_str =
+      std::to_string(std::numeric_limits<unsigned long long>::max());
+  if (value.size() > max_value_str.size() ||
+      (value.size() == max_value_str.size() && value > max_value_str)) {
+    return std::nullopt;
+  }
+  unsigned long long number = 0;
+  std::from_chars(value.data(), value.data() + value.size(), number);
+  return number;
+}
+
+// Values of every digit count, plus the strings numeric detection must reject.
+std::vector<std::string> make_values(const std::size_t count) {
+  std::vector<std::string> values;
+  unsigned long long seed = 0x9E3779B97F4A7C15ULL;
+  for (std::size_t i = 0; i < count; ++i) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    switch (i % 4) {
+    case 0: values.push_back(std::to_string(seed % 100000)); break;
+    case 1: values.push_back(std::to_string(seed)); break;
+    case 2: values.push_back(std::format("{}ms", seed % 100000)); break;
+    default: values.push_back(std::format("/srv/data/{}", seed % 1000)); break;
+    }
+  }
+  return values;
+}
+
+template <typename Parse>
+void run_values(std::string_view name, const std::vector<std::string> &values, Parse parse) {
+  std::size_t next = 0;
+  bench::report(bench::run(name, 10000000, [&] {
+    bench::do_not_optimize(parse(values[next]));
+    next = next + 1 == values.size() ? 0 : next + 1;
+  }));
+}
+
+bench::argv_t make_shard_argv(const std::size_t shards) {
+  std::vector<std::string> argv{"prog"};
+  for (std::size_t i = 0; i < shards; ++i) {
+    argv.push_back(std::format("--shard-{}={}", i, i * 2654435761ULL));
+  }
+  return bench::argv_t(std::move(argv));
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  const auto values = make_values(4096);
+  run_values("numeric/value/three_pass", values, three_pass_ull);
+  run_values("numeric/value/parse_ull", values, args::detail::parse_ull_);
+
+  for (const std::size_t shards : {100, 10000}) {
+    auto argv = make_shard_argv(shards);
+    const auto name = std::format("numeric/parse/shards/{}", shards);
+    bench::report(bench::run(name, shards >= 10000 ? 200 : 20000, [&argv] {
+      args::sequencer<checker_t> parser(argv.argc(), argv.argv());
+      bench::do_not_optimize(parser.get_args().size());
+    }));
+  }
+  return bench::finish("numeric", argc, argv);
+}
@@ -0,0 +1,260 @@
+// End-to-end parser suite over synthetic argv shapes: sequencer
+// construction (also into a monotonic arena and with instrumented_t), 512
+// feature switches stored as arguments or registered as bits, the
+// find_early_exit scan, typed and checked lookups with and without a
+// checker_cache, get_some_args, snapshot
+// writes and lookups, and argv_to_string_ranges_. Pass `--json=<path>` to
+// record the results.
+
+#include "args.h++"
+#include "args/checker_cache.h++"
+#include "bench.h++"
+
+#include <charconv>
+#include <cstddef>
+#include <format>
+#include <memory_resource>
+#include <span>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+using sequencer_t = args::sequencer<checker_t>;
+using pmr_sequencer_t = args::sequencer<checker_t, bool, args::parse_sync_t, args::pmr::args_t>;
+using instrumented_sequencer_t =
+    args::sequencer<checker_t, bool, args::parse_sync_t, args::args_t, args::instrumented_t>;
+
+// Parses `host:port` when built, as an address option's checker would.
+struct addr_checker_t {
+  std::string host;
+  unsigned long long port{0};
+
+  explicit addr_checker_t(const std::string_view text) {
+    const auto colon = text.rfind(':');
+    if (colon != std::string_view::npos) {
+      host = text.substr(0, colon);
+      const auto digits = text.substr(colon + 1);
+      std::from_chars(digits.data(), digits.data() + digits.size(), port);
+    }
+  }
+  explicit addr_checker_t(const checker_t &) {}
+};
+
+struct shape_t {
+  std::string name;
+  bench::argv_t argv;
+  std::size_t iterations;
+};
+
+std::vector<shape_t> make_shapes() {
+  std::vector<shape_t> shapes;
+
+  shapes.push_back({"few_flags",
+                    bench::argv_t({"prog", "serve", "--verbose", "--port=8080", "--host=localhost"}),
+                    200000});
+
+  std::vector<std::string> many{"prog", "build"};
+  for (std::size_t i = 0; i < 200; ++i) {
+    many.push_back(i % 3 == 0 ? std::format("--enable-feature-{}", i)
+                              : std::format("--option-{}=value-{}", i, i));
+  }
+  shapes.push_back({"many_flags", bench::argv_t(std::move(many)), 5000});
+
+  std::vector<std::string> long_values{"prog"};
+  for (std::size_t i = 0; i < 16; ++i) {
+    const std::string value(4096, static_cast<char>('a' + i));
+    long_values.push_back(std::format("--path-{}={}", i, value));
+  }
+  shapes.push_back({"long_values", bench::argv_t(std::move(long_values)), 20000});
+
+  std::vector<std::string> numeric{"prog"};
+  for (std::size_t i = 0; i < 200; ++i) {
+    numeric.push_back(std::format("--shard-{}={}", i, i * 2654435761ULL));
+  }
+  shapes.push_back({"numeric_heavy", bench::argv_t(std::move(numeric)), 5000});
+
+  // help and version stop parsing: the trailing flags are never looked at.
+  std::vector<std::string> help{"prog", "--help=serve"};
+  std::vector<std::string> version{"prog", "--version"};
+  for (std::size_t i = 0; i < 200; ++i) {
+    help.push_back(std::format("--option-{}={}", i, i));
+    version.push_back(std::format("--option-{}={}", i, i));
+  }
+  shapes.push_back({"help_early_exit", bench::argv_t(std::move(help)), 200000});
+  shapes.push_back({"version_early_exit", bench::argv_t(std::move(version)), 200000});
+  // what a health checker runs every few seconds.
+  shapes.push_back({"version_probe", bench::argv_t({"prog", "--version"}), 1000000});
+
+  return shapes;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  auto shapes = make_shapes();
+
+  for (auto &shape : shapes) {
+    const auto name = std::format("parser/construct/{}", shape.name);
+    bench::report(bench::run(name, shape.iterations, [&shape] {
+      sequencer_t parser(shape.argv.argc(), shape.argv.argv());
+      bench::do_not_optimize(parser.get_args().size());
+    }));
+  }
+
+  // the same shapes parsed into a monotonic arena that is released per run,
+  // as a service re-parsing forwarded argv would.
+  std::vector<std::byte> arena_buffer(1 << 20);
+  for (auto &shape : shapes) {
+    const auto name = std::format("parser/construct_pmr/{}", shape.name);
+    bench::report(bench::run(name, shape.iterations, [&shape, &arena_buffer] {
+      std::pmr::monotonic_buffer_resource arena(arena_buffer.data(), arena_buffer.size());
+      pmr_sequencer_t parser(std::allocator_arg, &arena, shape.argv.argc(), shape.argv.argv());
+      bench::do_not_optimize(parser.get_args().size());
+    }));
+  }
+
+  // the same shapes with instrumented_t recording parse_stats_t; the
+  // construct/ results above are the cost with instrumentation off.
+  for (auto &shape : shapes) {
+    const auto name = std::format("parser/construct_instrumented/{}", shape.name);
+    bench::report(bench::run(name, shape.iterations, [&shape] {
+      instrumented_sequencer_t parser(shape.argv.argc(), shape.argv.argv());
+      bench::do_not_optimize(parser.stats().total.count());
+    }));
+  }
+
+  // feature-flag-heavy command lines: 512 `--enable-*`/`--disable-*` switches
+  // as map entries, then registered and kept as bits.
+  std::vector<std::string> features;
+  std::vector<std::string> feature_args{"prog"};
+  for (std::size_t i = 0; i < 512; ++i) {
+    features.push_back(std::format("feature-{}", i));
+    feature_args.push_back(
+        std::format(i % 2 == 0 ? "--enable-feature-{}" : "--disable-feature-{}", i));
+  }
+  bench::argv_t feature_argv(std::move(feature_args));
+  bench::report(bench::run("parser/switches/512_stored", 5000, [&] {
+    sequencer_t parser(feature_argv.argc(), feature_argv.argv());
+    bench::do_not_optimize(parser.get_args().size());
+  }));
+  sequencer_t switch_parser(std::nullopt, std::nullopt, std::nullopt, features);
+  bench::report(bench::run("parser/switches/512_registered", 5000, [&] {
+    switch_parser.parse(feature_argv.argc(), feature_argv.argv());
+    bench::do_not_optimize(switch_parser.switches().count());
+  }));
+  sequencer_t stored_parser;
+  stored_parser.parse(feature_argv.argc(), feature_argv.argv());
+  const auto mask = switch_parser.switches().mask({"feature-0", "feature-2", "feature-510"});
+  bench::report(bench::run("parser/switches/mask_all", 5000000, [&] {
+    bench::do_not_optimize(switch_parser.switches().all(mask));
+  }));
+  bench::report(bench::run("parser/switches/three_get_option_bool", 5000000, [&] {
+    bench::do_not_optimize(stored_parser.get_option_bool("enable-feature-0"));
+    bench::do_not_optimize(stored_parser.get_option_bool("enable-feature-2"));
+    bench::do_not_optimize(stored_parser.get_option_bool("enable-feature-510"));
+  }));
+
+  auto &few = shapes.front().argv;
+  const sequencer_t parser(few.argc(), few.argv());
+  const std::string port = "port";
+  const std::string host = "host";
+  const std::string verbose = "verbose";
+  const std::string missing = "missing";
+
+  bench::report(bench::run("parser/get_arg/unsigned_long_long", 5000000, [&] {
+    bench::do_not_optimize(parser.get_arg<unsigned long long>(port));
+  }));
+  bench::report(bench::run("parser/get_arg/string", 5000000, [&] {
+    bench::do_not_optimize(parser.get_arg<std::string>(host));
+  }));
+  bench::report(bench::run("parser/get_arg/missing", 5000000, [&] {
+    bench::do_not_optimize(parser.get_arg<bool>(missing));
+  }));
+  bench::report(bench::run("parser/get_option_uint", 5000000, [&] {
+    bench::do_not_optimize(parser.get_option_uint(port));
+  }));
+  bench::report(bench::run("parser/get_option_string", 5000000, [&] {
+    bench::do_not_optimize(parser.get_option_string(host));
+  }));
+  bench::report(bench::run("parser/get_option_bool", 5000000, [&] {
+    bench::do_not_optimize(parser.get_option_bool(verbose));
+  }));
+
+  // a validating checker rebuilt on every read against one memoized in a
+  // checker_cache.
+  bench::argv_t addr_argv({"prog", "serve", "--bind-addr=192.168.100.200:8443", "--verbose"});
+  const args::sequencer<addr_checker_t> addr_parser(addr_argv.argc(), addr_argv.argv());
+  bench::report(bench::run("parser/get_option_addr/validating", 5000000, [&] {
+    bench::do_not_optimize(addr_parser.get_option_addr("bind-addr").port);
+  }));
+  args::checker_cache checkers(addr_parser);
+  checkers.build();
+  bench::report(bench::run("parser/checker_cache/get", 5000000, [&] {
+    bench::do_not_optimize(checkers.get("bind-addr").port);
+  }));
+
+  // string literals used to build a std::string per call; handles skip the hash.
+  sequencer_t keyed_parser(few.argc(), few.argv());
+  const auto port_key = keyed_parser.key("port");
+  const auto verbose_key = keyed_parser.key("verbose");
+  bench::report(bench::run("parser/has/literal", 5000000, [&] {
+    bench::do_not_optimize(keyed_parser.has("verbose"));
+  }));
+  bench::report(bench::run("parser/has/key", 5000000, [&] {
+    bench::do_not_optimize(keyed_parser.has(verbose_key));
+  }));
+  bench::report(bench::run("parser/get_arg/literal", 5000000, [&] {
+    bench::do_not_optimize(keyed_parser.get_arg<unsigned long long>("port"));
+  }));
+  bench::report(bench::run("parser/get_arg/key", 5000000, [&] {
+    bench::do_not_optimize(keyed_parser.get_arg<unsigned long long>(port_key));
+  }));
+
+  // the scan a probe can run on raw argv before building a sequencer.
+  auto &probe = shapes.back().argv;
+  const std::span<const char *const> probe_argv(probe.argv(),
+                                                static_cast<std::size_t>(probe.argc()));
+  bench::report(bench::run("parser/find_early_exit/version_probe", 5000000, [&] {
+    bench::do_not_optimize(args::find_early_exit(probe_argv).has_value());
+  }));
+
+  auto &many = shapes[1].argv;
+  const sequencer_t many_parser(many.argc(), many.argv());
+  std::vector<std::string> selection;
+  for (std::size_t i = 0; i < 200; i += 10) {
+    selection.push_back(std::format("option-{}", i + 1));
+  }
+  bench::report(bench::run("parser/get_some_args/20_of_200", 100000, [&] {
+    bench::do_not_optimize(many_parser.get_some_args(selection).size());
+  }));
+
+  // a worker reading the many_flags configuration from a snapshot blob
+  // instead of re-parsing the forwarded argv.
+  std::vector<std::byte> snapshot_buffer(many_parser.snapshot().size());
+  bench::report(bench::run("parser/snapshot/write_many_flags", 20000, [&] {
+    bench::do_not_optimize(many_parser.snapshot(snapshot_buffer));
+  }));
+  bench::report(bench::run("parser/snapshot/view_many_flags", 20000, [&] {
+    const args::snapshot_view_t view(snapshot_buffer);
+    bench::do_not_optimize(view.size());
+  }));
+  const args::snapshot_view_t snapshot_view(snapshot_buffer);
+  bench::report(bench::run("parser/snapshot/get_some_args_20_of_200", 100000, [&] {
+    for (const auto &key : selection) {
+      bench::do_not_optimize(snapshot_view.get_view(key).has_value());
+    }
+  }));
+
+  for (auto &shape : shapes) {
+    const auto name = std::format("parser/argv_to_string_ranges_/{}", shape.name);
+    bench::report(bench::run(name, shape.iterations, [&shape] {
+      const auto joined = sequencer_t::argv_to_string_ranges_(shape.argv.argc(), shape.argv.argv());
+      bench::do_not_optimize(joined.size());
+    }));
+  }
+
+  return bench::finish("parser", argc, argv);
+}
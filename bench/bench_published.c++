@@ -0,0 +1,162 @@
+// Hot-reloaded configuration read from many threads: get_arg lookups through
+// published_t<snapshot_t> readers against the same lookups through a
+// std::shared_ptr guarded by a std::mutex, on 1, 2, 4 ... hardware_concurrency
+// reader threads while another thread publishes a new snapshot every
+// millisecond. Reports reads per second and the scaling over one thread. Pass
+// `--json=<path>` to record the results.
+
+#include "args.h++"
+#include "args/published.h++"
+#include "bench.h++"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+using sequencer_t = args::sequencer<checker_t>;
+
+constexpr std::size_t reads_per_thread = 2000000;
+
+// a server configuration of 64 options, reparsed with a new `--generation`
+// on every reload.
+std::vector<std::byte> make_snapshot(const std::size_t generation) {
+  std::vector<std::string> options{"server", "serve",
+                                   std::format("--generation={}", generation)};
+  for (std::size_t i = 0; i < 64; ++i) {
+    options.push_back(std::format("--option-{}=value-{}", i, i));
+  }
+  options.push_back("--threads=64");
+  bench::argv_t argv(std::move(options));
+  const sequencer_t parser(argv.argc(), argv.argv());
+  return parser.snapshot();
+}
+
+// Publishes a new configuration every millisecond until stopped.
+class reloader_t {
+public:
+  template <typename Publish> explicit reloader_t(Publish publish) {
+    thread_ = std::thread([this, publish] {
+      for (std::size_t generation = 1; !stop_.load(std::memory_order_relaxed); ++generation) {
+        publish(generation);
+        ++reloads_;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    });
+  }
+
+  std::size_t stop() {
+    stop_ = true;
+    thread_.join();
+    return reloads_;
+  }
+
+private:
+  std::atomic<bool> stop_{false};
+  std::size_t reloads_{0};
+  std::thread thread_;
+};
+
+// Runs `read` reads_per_thread times on each of `threads` threads.
+template <typename Read> void read_on(const std::size_t threads, Read read) {
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < threads; ++t) {
+    pool.emplace_back([&read] {
+      auto reader = read();
+      for (std::size_t i = 0; i < reads_per_thread; ++i) {
+        bench::do_not_optimize(reader());
+      }
+    });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+double report_throughput(const std::string_view name, const std::size_t threads,
+                         const bench::result_t &result, const std::size_t reloads,
+                         const double baseline) {
+  bench::report(result);
+  const double reads_per_s =
+      1e9 * static_cast<double>(reads_per_thread * threads) / result.ns_per_op;
+  std::printf("%-48s %14.0f reads/s %6.2fx %8zu reloads\n",
+              std::format("{}/throughput", name).c_str(), reads_per_s,
+              baseline > 0 ? reads_per_s / baseline : 1.0, reloads);
+  return reads_per_s;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  const std::size_t max_threads = std::max(1U, std::thread::hardware_concurrency());
+
+  double published_single = 0;
+  for (std::size_t threads = 1;; threads = std::min(threads * 2, max_threads)) {
+    args::published_t<args::snapshot_t> config;
+    config.emplace(make_snapshot(0));
+    reloader_t reloader([&config](const std::size_t generation) {
+      config.emplace(make_snapshot(generation));
+    });
+
+    const auto name = std::format("published/get_arg/{}_threads", threads);
+    const auto result = bench::run(name, 1, [&] {
+      read_on(threads, [&config] {
+        return [reader = config.reader()]() mutable {
+          return reader->get_arg<unsigned long long>("threads");
+        };
+      });
+    });
+    const auto reads_per_s =
+        report_throughput(name, threads, result, reloader.stop(), published_single);
+    if (threads == 1) {
+      published_single = reads_per_s;
+    }
+    if (threads == max_threads) {
+      break;
+    }
+  }
+
+  // the same reads through the mutex a server would otherwise take.
+  double mutex_single = 0;
+  for (std::size_t threads = 1;; threads = std::min(threads * 2, max_threads)) {
+    std::mutex mutex;
+    std::shared_ptr<const args::snapshot_t> config =
+        std::make_shared<const args::snapshot_t>(make_snapshot(0));
+    reloader_t reloader([&](const std::size_t generation) {
+      auto next = std::make_shared<const args::snapshot_t>(make_snapshot(generation));
+      const std::lock_guard lock(mutex);
+      config = std::move(next);
+    });
+
+    const auto name = std::format("published/mutex_get_arg/{}_threads", threads);
+    const auto result = bench::run(name, 1, [&] {
+      read_on(threads, [&] {
+        return [&] {
+          const std::lock_guard lock(mutex);
+          return config->get_arg<unsigned long long>("threads");
+        };
+      });
+    });
+    const auto reads_per_s =
+        report_throughput(name, threads, result, reloader.stop(), mutex_single);
+    if (threads == 1) {
+      mutex_single = reads_per_s;
+    }
+    if (threads == max_threads) {
+      break;
+    }
+  }
+
+  return bench::finish("published", argc, argv);
+}
@@ -0,0 +1,69 @@
+// Re-parsing command lines received by a long-running process: a new
+// sequencer per command line against parse() on one reused sequencer, with
+// args_t and args_flat_t storage, 1M parses each on a single thread. Pass
+// `--json=<path>` to record the results.
+
+#include "args.h++"
+#include "bench.h++"
+
+#include <cstdio>
+#include <format>
+#include <string_view>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+using sequencer_t = args::sequencer<checker_t>;
+using flat_sequencer_t = args::sequencer<checker_t, bool, args::parse_sync_t, args::args_flat_t>;
+
+constexpr std::size_t parses = 1000000;
+
+// Command lines of the shape a control socket hands over, cycled through.
+std::vector<bench::argv_t> make_command_lines() {
+  std::vector<bench::argv_t> lines;
+  for (std::size_t i = 0; i < 16; ++i) {
+    lines.emplace_back(std::vector<std::string>{
+        "ctl", i % 2 == 0 ? "restart" : "status", std::format("--job={}", 1000 + i),
+        std::format("--timeout={}s", 5 + i), "--verbose", std::format("--node=worker-{}", i % 4)});
+  }
+  return lines;
+}
+
+void report_throughput(const std::string_view name, const bench::result_t &result) {
+  bench::report(result);
+  std::printf("%-48s %14.0f parses/s\n", std::format("{}/throughput", name).c_str(),
+              1e9 / result.ns_per_op);
+}
+
+template <typename Sequencer>
+void run_storage(const std::string_view storage, std::vector<bench::argv_t> &lines) {
+  std::size_t next = 0;
+  const auto construct_name = std::format("reparse/{}/construct", storage);
+  report_throughput(construct_name, bench::run(construct_name, parses, [&] {
+    auto &line = lines[next];
+    next = next + 1 == lines.size() ? 0 : next + 1;
+    const Sequencer parser(line.argc(), line.argv());
+    bench::do_not_optimize(parser.get_args().size());
+  }));
+
+  Sequencer parser;
+  const auto parse_name = std::format("reparse/{}/parse", storage);
+  report_throughput(parse_name, bench::run(parse_name, parses, [&] {
+    auto &line = lines[next];
+    next = next + 1 == lines.size() ? 0 : next + 1;
+    parser.parse(line.argc(), line.argv());
+    bench::do_not_optimize(parser.get_args().size());
+  }));
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  auto lines = make_command_lines();
+  run_storage<sequencer_t>("args_t", lines);
+  run_storage<flat_sequencer_t>("args_flat_t", lines);
+  return bench::finish("reparse", argc, argv);
+}
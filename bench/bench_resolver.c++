@@ -0,0 +1,64 @@
+// First-lookup cost of the layered resolver in a process with a 5,000-entry
+// environment, against scanning the whole environment up front.
+
+#include "args.h++"
+#include "args/resolver.h++"
+#include "bench.h++"
+
+#include <cstdlib>
+#include <format>
+#include <unistd.h>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+
+constexpr std::size_t environment_size = 5000;
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  for (std::size_t i = 0; i < environment_size; ++i) {
+    ::setenv(std::format("BENCH_SETTING_{}", i).c_str(), std::format("{}", i * 7).c_str(), 1);
+  }
+
+  bench::argv_t parser_argv{{"prog", "--threads=8"}};
+  const args::sequencer<checker_t> parser(parser_argv.argc(), parser_argv.argv());
+
+  // eager: every BENCH_ variable is typed and stored before the first lookup.
+  bench::report(bench::run("resolver/eager_scan/5000", 200, [] {
+    args::args_t values;
+    for (char **entry = environ; *entry != nullptr; ++entry) {
+      const std::string_view text(*entry);
+      if (!text.starts_with("BENCH_")) {
+        continue;
+      }
+      const auto equal_sign_pos = text.find('=');
+      const auto value = text.substr(equal_sign_pos + 1);
+      if (const auto number = args::detail::parse_ull_(value)) {
+        values[std::string(text.substr(0, equal_sign_pos))] = *number;
+      } else {
+        values[std::string(text.substr(0, equal_sign_pos))] = std::string(value);
+      }
+    }
+    bench::do_not_optimize(values.size());
+  }));
+
+  // lazy: only the three keys the program asks for are read.
+  bench::report(bench::run("resolver/lazy/3_lookups", 200, [&parser] {
+    const args::resolver settings(parser, {.env_prefix = "BENCH_"});
+    bench::do_not_optimize(settings.find("threads"));
+    bench::do_not_optimize(settings.find("setting-42"));
+    bench::do_not_optimize(settings.find("setting-4999"));
+  }));
+
+  const args::resolver settings(parser, {.env_prefix = "BENCH_"});
+  (void)settings.find("setting-42");
+  bench::report(bench::run("resolver/memoized_lookup", 1000000, [&settings] {
+    bench::do_not_optimize(settings.find("setting-42"));
+  }));
+  return bench::finish("resolver", argc, argv);
+}
@@ -0,0 +1,51 @@
+// Parses a response file holding 1,000,000 arguments through `@path`.
+
+#include "args.h++"
+#include "bench.h++"
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+
+constexpr std::size_t argument_count = 1000000;
+// keys repeat so the map stays bounded and the tokenizer dominates.
+constexpr std::size_t distinct_keys = 10000;
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  const auto path = std::filesystem::temp_directory_path() / "nutsloop_args_bench_1m.rsp";
+  {
+    std::ofstream file(path, std::ios::binary);
+    for (std::size_t i = 0; i < argument_count; ++i) {
+      const auto key = i % distinct_keys;
+      switch (i % 4) {
+      case 0: file << std::format("--shard-{}={}\n", key, i); break;
+      case 1: file << std::format("--name-{}=\"value {}\"\n", key, i); break;
+      case 2: file << std::format("--enable-feature-{}\n", key); break;
+      default: file << std::format("--path-{}=/srv/data/{}\n", key, i); break;
+      }
+    }
+  }
+
+  const auto rsp = "@" + path.string();
+  bench::argv_t response_file_argv{{"prog", rsp}};
+
+  auto result = bench::run("response_file/parse/1M", 5, [&response_file_argv] {
+    args::sequencer<checker_t> parser(response_file_argv.argc(), response_file_argv.argv());
+    bench::do_not_optimize(parser.get_args().size());
+  });
+  bench::report(result);
+  std::printf("%-48s %14.1f ns/arg\n", "response_file/per_argument",
+              result.ns_per_op / static_cast<double>(argument_count));
+
+  std::filesystem::remove(path);
+  return bench::finish("response_file", argc, argv);
+}
@@ -0,0 +1,30 @@
+// Startup latency of sequencer construction: synchronous parse (default)
+// against the threaded parse policy.
+
+#include "args.h++"
+#include "bench.h++"
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+
+template <typename ParsePolicy> bench::result_t construct(std::string_view name, bench::argv_t &argv) {
+  return bench::run(name, 20000, [&argv] {
+    args::sequencer<checker_t, bool, ParsePolicy> parser(argv.argc(), argv.argv());
+    bench::do_not_optimize(parser.get_args().size());
+  });
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  bench::argv_t few{{"prog", "serve", "--verbose", "--port=8080", "--host=localhost"}};
+
+  bench::report(construct<args::parse_sync_t>("startup/parse_sync_t", few));
+  bench::report(construct<args::parse_threaded_t>("startup/parse_threaded_t", few));
+
+  return bench::finish("startup", argc, argv);
+}
@@ -0,0 +1,62 @@
+// Parse and lookup cost of the default args_t (std::unordered_map) against
+// args_flat_t at 10, 100 and 10,000 options.
+
+#include "args.h++"
+#include "bench.h++"
+
+#include <format>
+
+namespace {
+
+namespace args = nutsloop::args;
+namespace bench = nutsloop::args::bench;
+
+using checker_t = args::args_key_value_t_;
+
+template <typename Storage>
+using sequencer_t = args::sequencer<checker_t, bool, args::parse_sync_t, Storage>;
+
+bench::argv_t make_argv(const std::size_t options) {
+  std::vector<std::string> argv{"prog"};
+  for (std::size_t i = 0; i < options; ++i) {
+    argv.push_back(i % 2 == 0 ? std::format("--option-{}={}", i, i)
+                              : std::format("--option-{}=value-{}", i, i));
+  }
+  return bench::argv_t(std::move(argv));
+}
+
+template <typename Storage>
+void run_storage(std::string_view storage_name, const std::size_t options,
+                 const std::size_t iterations) {
+  auto argv = make_argv(options);
+
+  const auto parse_name = std::format("storage/{}/parse/{}", storage_name, options);
+  bench::report(bench::run(parse_name, iterations, [&argv] {
+    sequencer_t<Storage> parser(argv.argc(), argv.argv());
+    bench::do_not_optimize(parser.get_args().size());
+  }));
+
+  const sequencer_t<Storage> parser(argv.argc(), argv.argv());
+  std::vector<std::string> keys;
+  for (std::size_t i = 0; i < options; ++i) {
+    keys.push_back(std::format("option-{}", i));
+  }
+
+  std::size_t next = 0;
+  const auto lookup_name = std::format("storage/{}/lookup/{}", storage_name, options);
+  bench::report(bench::run(lookup_name, 1000000, [&] {
+    bench::do_not_optimize(parser.has(keys[next]));
+    next = next + 1 == keys.size() ? 0 : next + 1;
+  }));
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  for (const auto &[options, iterations] :
+       {std::pair<std::size_t, std::size_t>{10, 100000}, {100, 10000}, {10000, 100}}) {
+    run_storage<args::args_t>("args_t", options, iterations);
+    run_storage<args::args_flat_t>("args_flat_t", options, iterations);
+  }
+  return bench::finish("storage", argc, argv);
+}
@@ -1,18 +1,30 @@
 #pragma once
 
+#include "args/early_exit.h++"
+#include "args/join.h++"
 #include "args/option_types.h++"
+#include "args/parse_value.h++"
+#include "args/snapshot.h++"
+#include "args/types/args_flat_t.h++"
+#include "args/types/args_hash_t.h++"
+#include "args/types/args_key_t.h++"
 #include "args/types/args_key_value_t.h++"
 #include "args/types/args_t.h++"
+#include "args/types/args_values_t.h++"
+#include "args/types/instrumentation_t.h++"
+#include "args/types/mapped_file_t.h++"
+#include "args/types/parse_policy_t.h++"
 #include "args/types/skip_digit_check_t.h++"
+#include "args/types/switch_set_t.h++"
 #include "args/types/version_t.h++"
 
 #include <algorithm>
 #include <array>
-#include <cctype>
 #include <concepts>
 #include <format>
 #include <map>
-#include <numeric>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <span>
 #include <string>
@@ -26,48 +38,268 @@ namespace nutsloop::args {
 template <typename CheckerClass>
 concept ArgsChecker = std::constructible_from<CheckerClass, args_key_value_t_>;
 
+// A checker that can also be built from a std::string_view: string values are
+// then passed to it as a view of the stored string instead of a copy.
+template <typename CheckerClass>
+concept ArgsViewChecker =
+    ArgsChecker<CheckerClass> && std::constructible_from<CheckerClass, std::string_view>;
+
+namespace detail {
+
+// Builds the checker of a stored value. A checker constructible from
+// `const args_key_value_t_ &` receives the stored value itself, and an
+// ArgsViewChecker a view of a stored string, so neither copies it.
+template <ArgsChecker CheckerClass> CheckerClass make_checker_(const args_key_value_t_ &value) {
+  if constexpr (ArgsViewChecker<CheckerClass>) {
+    if (const auto *text = std::get_if<std::string>(&value)) {
+      return CheckerClass(std::string_view(*text));
+    }
+  }
+  return CheckerClass(value);
+}
+
+} // namespace detail
+
 template <typename HelperClass>
 concept ArgsHelper =
     std::constructible_from<HelperClass, std::string, std::array<int, 4>>;
 
-template <typename CheckerClass, typename HelperClass = bool>
-  requires ArgsChecker<CheckerClass> &&
-           (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
+template <typename ParsePolicy>
+concept ArgsParsePolicy =
+    std::same_as<ParsePolicy, parse_sync_t> || std::same_as<ParsePolicy, parse_threaded_t>;
+
+// Backing store for parsed arguments: args_t (default) or args_flat_t, or any
+// map-like type with the same lookup surface and value variant. find() and
+// contains() must accept a std::string_view, so getters do not allocate.
+template <typename Storage>
+concept ArgsStorage =
+    std::same_as<typename Storage::mapped_type, args_key_value_t_> &&
+    requires(Storage storage, const Storage &view, std::string key, std::string_view lookup,
+             const std::string &owned) {
+      { storage[std::move(key)] } -> std::same_as<args_key_value_t_ &>;
+      { view.find(lookup)->second } -> std::convertible_to<const args_key_value_t_ &>;
+      { view.find(lookup) == view.end() } -> std::convertible_to<bool>;
+      { view.contains(lookup) } -> std::convertible_to<bool>;
+      { view.at(owned) } -> std::convertible_to<const args_key_value_t_ &>;
+      { view.size() } -> std::convertible_to<std::size_t>;
+      storage.clear();
+    };
+
+template <typename CheckerClass, typename HelperClass = bool, typename ParsePolicy = parse_sync_t,
+          typename Storage = args_t, typename Instrumentation = no_instrumentation_t>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
 
 class sequencer {
 
   // MARK (sequencer) private types declaration.
-  using skip_digit_check_list_t_ = std::unordered_set<std::string>;
+  using skip_digit_check_list_t_ =
+      std::pmr::unordered_set<std::pmr::string, args_hash_t, std::equal_to<>>;
+  using list_keys_list_t_ = std::pmr::unordered_set<std::pmr::string, args_hash_t, std::equal_to<>>;
+  using typed_keys_list_t_ =
+      std::pmr::unordered_set<std::pmr::string, args_hash_t, std::equal_to<>>;
+  using response_file_stack_t_ = std::pmr::vector<mapped_file_t::identity_t>;
   using version_t_ = std::array<int, 4>;
   using args_key_value_t_ =
-      std::variant<std::string, unsigned long long, bool, std::nullptr_t>;
+      std::variant<std::string, unsigned long long, bool, std::nullptr_t, long long, double,
+                   args_duration_t, args_size_t>;
 
 public:
+  using checker_t = CheckerClass;
+
   sequencer(int argc, char *argv[],
             const skip_digit_check_t &skip_digit_check = std::nullopt,
-            const version_opt_t &version = std::nullopt);
+            const version_opt_t &version = std::nullopt,
+            const list_keys_t &list_keys = std::nullopt,
+            const switches_t &switches = std::nullopt,
+            const typed_keys_t &typed_keys = std::nullopt);
+
+  /**
+   * Parses like the constructor above, drawing every internal buffer from
+   * `resource`: the value arena, the skip_digit_check, list_keys and
+   * typed_keys sets, the response file bookkeeping and, when Storage is a
+   * std::pmr container such as pmr::args_t, the stored arguments. Building the sequencer over a
+   * std::pmr::monotonic_buffer_resource lets all of its parse state be
+   * released in one step.
+   *
+   * `resource` must outlive the sequencer. Strings held by args_key_value_t_
+   * and the command are std::string, so only those longer than the
+   * small-string buffer still come from the global heap.
+   */
+  sequencer(std::allocator_arg_t, std::pmr::memory_resource *resource, int argc, char *argv[],
+            const skip_digit_check_t &skip_digit_check = std::nullopt,
+            const version_opt_t &version = std::nullopt,
+            const list_keys_t &list_keys = std::nullopt,
+            const switches_t &switches = std::nullopt,
+            const typed_keys_t &typed_keys = std::nullopt);
+
+  /**
+   * Creates a sequencer that has not parsed anything yet, for use with
+   * parse(). The skip_digit_check, list_keys and typed_keys sets, the version
+   * and the registered switches are copied once and kept across parses.
+   */
+  explicit sequencer(const skip_digit_check_t &skip_digit_check = std::nullopt,
+                     const version_opt_t &version = std::nullopt,
+                     const list_keys_t &list_keys = std::nullopt,
+                     const switches_t &switches = std::nullopt,
+                     const typed_keys_t &typed_keys = std::nullopt);
+
+  sequencer(std::allocator_arg_t, std::pmr::memory_resource *resource,
+            const skip_digit_check_t &skip_digit_check = std::nullopt,
+            const version_opt_t &version = std::nullopt,
+            const list_keys_t &list_keys = std::nullopt,
+            const switches_t &switches = std::nullopt,
+            const typed_keys_t &typed_keys = std::nullopt);
 
   ~sequencer() = default;
 
+  /**
+   * Replaces the result of the previous parse with the parse of `argv`.
+   *
+   * `argv` is laid out like the constructor's: element 0 is the program name
+   * and is skipped. Unlike the constructor, an `argv` without arguments is
+   * not an error and leaves the sequencer empty. The containers and buffers
+   * of the previous parse are reused, so re-parsing command lines of a
+   * similar shape does not allocate beyond the stored strings. With
+   * parse_threaded_t each call still parses on its own thread.
+   *
+   * Views returned by get_all() are invalidated. If parsing throws, the
+   * sequencer holds a partial result until the next parse() or reset().
+   *
+   * @throws std::invalid_argument on the same input as the constructor.
+   */
+  void parse(std::span<const char *const> argv);
+  void parse(int argc, char *argv[]);
+
+  /**
+   * Parses `argv` as the arguments of `command`, already picked out by a
+   * dispatcher such as command_tree: get_command() returns `command`, which
+   * may be a path such as "remote add", and no token of `argv` is taken as
+   * the command. Element 0 of `argv` is skipped as in parse().
+   */
+  void parse(std::string_view command, std::span<const char *const> argv);
+
+  // Clears the command, the arguments and every stored value, including a
+  // help or version request, keeping allocated buffers for the next parse.
+  void reset();
+
   HelperClass get_help(std::string argument)
     requires ArgsHelper<HelperClass>;
 
-  CheckerClass get_option_string(const std::string &key) const;
+  CheckerClass get_option_string(std::string_view key) const;
+
+  CheckerClass get_option_addr(std::string_view key) const;
 
-  CheckerClass get_option_addr(const std::string &key) const;
+  CheckerClass get_option_uint(std::string_view key) const;
 
-  CheckerClass get_option_uint(const std::string &key) const;
+  CheckerClass get_option_bool(std::string_view key) const;
 
-  CheckerClass get_option_bool(const std::string &key) const;
+  [[nodiscard]] bool has(std::string_view key) const;
+
+  /**
+   * Interns `name` and returns its handle; the same name always gives the
+   * same handle. has() and get_arg() on a handle index the value the last
+   * parse left for the key instead of hashing the name, which pays off for
+   * keys looked up over and over. Each parse() looks the interned keys up
+   * once, so intern only the keys that are read repeatedly.
+   */
+  [[nodiscard]] args_key_t key(std::string_view name);
 
-  [[nodiscard]] bool has(const std::string &key) const;
+  // has() for an interned key. @throws std::invalid_argument for a handle
+  // this sequencer did not issue.
+  [[nodiscard]] bool has(args_key_t key) const;
 
-  [[nodiscard]] const args_t &get_args() const { return arguments_; }
+  [[nodiscard]] const Storage &get_args() const { return arguments_; }
 
   [[nodiscard]] const args_command_t &get_command() const { return command_; }
 
+  // The version a `--version` or `-v` request stores, formatted once when
+  // the sequencer is built.
+  [[nodiscard]] std::string_view version_string() const noexcept {
+    return version_string_.view();
+  }
+
+  /**
+   * The switches registered with the `switches` constructor argument, as
+   * bitsets. They are kept here instead of in get_args(): has(),
+   * get_option_bool() and get_arg<bool>() still answer for `enable-X`,
+   * `disable-X` and `X` as before, but get_args() and get_all() do not list
+   * them.
+   */
+  [[nodiscard]] const switch_set_t &switches() const noexcept { return switches_; }
+
+  // Keys passed as `skip_digit_check`, whose values always stay strings.
+  [[nodiscard]] const skip_digit_check_list_t_ &skip_digit_check() const noexcept {
+    return skip_digit_check_;
+  }
+
+  // Keys passed as `typed_keys`: only their values are inferred as signed,
+  // floating-point, durations and sizes.
+  [[nodiscard]] const typed_keys_list_t_ &typed_keys() const noexcept { return typed_keys_; }
+
+  // Memory resource the parse state is allocated from. With instrumented_t
+  // it counts the allocations it forwards to the resource the sequencer was
+  // given.
+  [[nodiscard]] std::pmr::memory_resource *resource() const noexcept { return resource_; }
+
+  /**
+   * What the last parse did: time per parse_phase_t, allocations from
+   * resource(), arguments by kind and storage rehashes. Only a parse that
+   * completes updates the stats.
+   */
+  [[nodiscard]] const parse_stats_t &stats() const noexcept
+    requires std::same_as<Instrumentation, instrumented_t>
+  {
+    return recorder_.stats();
+  }
+
+  // Calls `callback` with stats() after every parse that completes, on the
+  // thread that parsed; the argv constructors parse before one can be set.
+  void on_parse(parse_stats_callback_t callback)
+    requires std::same_as<Instrumentation, instrumented_t>
+  {
+    recorder_.on_parse(std::move(callback));
+  }
+
   template <OptionTypes T>
-  [[nodiscard]] std::optional<T> get_arg(const std::string &key) const;
+  [[nodiscard]] std::optional<T> get_arg(std::string_view key) const;
+
+  // get_arg() for an interned key. @throws std::invalid_argument for a
+  // handle this sequencer did not issue.
+  template <OptionTypes T> [[nodiscard]] std::optional<T> get_arg(args_key_t key) const;
+
+  /**
+   * Retrieves every value given for `key`, in command-line order.
+   *
+   * Repeated options (`--include=a --include=b`) and comma-separated values of
+   * keys passed as `list_keys` to the constructor (`--tags=a,b,c`) each add
+   * one element. With T = std::string every element is returned as the text
+   * it was given as, typed or not, so mixed lists such as `--tags=prod,2024`
+   * read as strings; switches read as `true` or `false`. String elements are
+   * views into the sequencer's value arena, and the span and its views are
+   * valid until the next parse() or reset().
+   *
+   * @tparam T The option type of the values.
+   * @param key The key to look up.
+   * @return A contiguous span of the values; empty when the key was not given.
+   * @throws std::invalid_argument if T is not std::string and some values for
+   * `key` are not of type T.
+   */
+  template <OptionTypes T>
+  [[nodiscard]] std::span<const args_value_view_t<T>> get_all(std::string_view key) const;
+
+  /**
+   * Serializes get_command() and the value get_arg() returns for every key,
+   * registered switches included, into a blob for snapshot_view_t. The blob
+   * has no pointers, so a process that maps it (from a memfd, shared memory
+   * or a file) answers has() and get_arg<T>() without parsing.
+   */
+  [[nodiscard]] std::vector<std::byte> snapshot() const;
+
+  // Writes the snapshot into `dest` and returns its size; nothing is written
+  // when `dest` is shorter than that.
+  std::size_t snapshot(std::span<std::byte> dest) const;
 
   /**
    * Retrieves a selection of argument key-value pairs from the parsed
@@ -82,46 +314,96 @@ public:
    *
    * @param selection A vector of strings representing the keys to filter and
    * retrieve.
-   * @return A map where the key is a string corresponding to the selected
-   * argument, and the value is an args_key_value_t variant representing its
-   * value. The returned map contains only the arguments that were found in the
-   * internal state corresponding to the provided selection.
+   * @return A map (of the sequencer's Storage type) where the key is a string
+   * corresponding to the selected argument, and the value is an
+   * args_key_value_t variant representing its value. The returned map contains
+   * only the arguments that were found in the internal state corresponding to
+   * the provided selection.
    */
-  [[nodiscard]] args_t
+  [[nodiscard]] Storage
   get_some_args(const std::vector<std::string> &selection) const;
   static std::string argv_to_string_ranges_(int argc, char *argv[],
                                             char separator = '|');
 
+  // Joins `argv` values into `dest` without allocating. Returns the joined
+  // length; nothing is written when `dest` is shorter than that.
+  static std::size_t argv_to_string_ranges_(int argc, char *argv[], std::span<char> dest,
+                                            char separator = '|');
+
 private:
-  args_t arguments_;
+  // declared first: resource_ is the recorder's counting resource.
+  [[no_unique_address]] detail::parse_recorder_t<Instrumentation> recorder_;
+  std::pmr::memory_resource *resource_;
+  Storage arguments_;
   args_command_t command_;
+  args_values_t values_;
   skip_digit_check_list_t_ skip_digit_check_;
+  list_keys_list_t_ list_keys_;
+  typed_keys_list_t_ typed_keys_;
+  detail::key_table_t keys_;
+  switch_set_t switches_;
   bool is_single_dash_{false};
+  bool expect_command_{true};
   size_t equal_sign_pos_{0};
-  std::string value_;
-  std::string key_;
-  std::string arg_;
+  std::string_view value_;
+  std::string_view key_;
+  std::string_view arg_;
   std::array<int, 4> version_{};
+  version_string_t version_string_;
+
+  void parse_(std::span<const char *const> argv);
+
+  // Value of an interned key, or nullptr when the last parse did not set it.
+  [[nodiscard]] const args_key_value_t_ *find_key_(args_key_t key) const;
+
+  // Runs parse_() on the calling thread or on a dedicated one, per ParsePolicy.
+  void parse_with_policy_(std::span<const char *const> argv);
+
+  // Expands `@path` response files, then hands the token to parse_arg_().
+  // Returns false once a help or version request stops parsing.
+  bool parse_token_(std::string_view token, response_file_stack_t_ &response_files);
+
+  // Applies the parsing rules to a single argument.
+  bool parse_arg_(std::string_view arg);
 
-  void parse_(int argc, char *argv[]);
+  // Stores a help or version request under "help" or "version".
+  void store_early_exit_(const early_exit_t &request);
+
+  bool expand_response_file_(const std::string &path, mapped_file_t &file,
+                             response_file_stack_t_ &response_files);
+
+  // Stores `value` under key_, keeping earlier values for get_all().
+  template <typename T> void store_(T value);
+
+  // Stores the comma-separated elements of value_ under key_.
+  void store_list_();
 
   void match_truthy_switch_();
 
+  // Records key_ in switches_ when it is a registered switch.
+  [[nodiscard]] bool match_registered_switch_();
+
+  // Entries of snapshot(), sorted by key; `switch_keys` holds the names of
+  // the registered switch forms they refer to.
+  [[nodiscard]] std::vector<detail::snapshot_item_t_>
+  snapshot_items_(std::vector<std::string> &switch_keys) const;
+
+  // Value `key` has as a registered switch form, see switch_set_t::find().
+  [[nodiscard]] std::optional<bool> find_switch_(std::string_view key) const;
+
   void process_dashes_();
 
   [[nodiscard]] bool match_enabling_switch_();
 
   [[nodiscard]] bool match_disabling_switch_();
 
-  [[nodiscard]] bool is_digit_() const;
-
   [[nodiscard]] bool does_skip_digit_check_() const;
 
-  [[nodiscard]] bool is_in_ull_range_() const;
-
-  [[nodiscard]] bool should_interpret_as_ull_() const;
+  // Typed value_, or std::monostate when it stays a string (always for keys
+  // in skip_digit_check).
+  [[nodiscard]] detail::inferred_value_t infer_value_() const;
 
-  [[nodiscard]] std::string strip_dashes_() const;
+  [[nodiscard]] std::string_view strip_dashes_() const;
 
   [[maybe_unused]] static std::string argv_to_string_(int argc, char *argv[]);
 };
@@ -131,6 +413,9 @@ private:
 #include "args/inline/argv_to_string_.inl"
 #include "args/inline/argv_to_string_ranges_.inl"
 #include "args/inline/does_skip_digit_check_.inl"
+#include "args/inline/expand_response_file_.inl"
+#include "args/inline/find_switch_.inl"
+#include "args/inline/get_all.inl"
 #include "args/inline/get_arg.inl"
 #include "args/inline/get_help.inl"
 #include "args/inline/get_option_addr.inl"
@@ -139,12 +424,20 @@ private:
 #include "args/inline/get_option_uint.inl"
 #include "args/inline/get_some_args.inl"
 #include "args/inline/has.inl"
-#include "args/inline/is_digit_.inl"
-#include "args/inline/is_in_ull_range_.inl"
+#include "args/inline/key.inl"
+#include "args/inline/infer_value_.inl"
 #include "args/inline/match_disabling_switch_.inl"
 #include "args/inline/match_enabling_switch_.inl"
+#include "args/inline/match_registered_switch_.inl"
 #include "args/inline/match_truthy_switch_.inl"
+#include "args/inline/parse.inl"
 #include "args/inline/parse_.inl"
+#include "args/inline/parse_arg_.inl"
+#include "args/inline/parse_with_policy_.inl"
 #include "args/inline/process_dashes_.inl"
-#include "args/inline/should_interpret_as_ull_.inl"
+#include "args/inline/reset.inl"
+#include "args/inline/snapshot.inl"
+#include "args/inline/store_.inl"
+#include "args/inline/store_early_exit_.inl"
+#include "args/inline/store_list_.inl"
 #include "args/inline/strip_dashes_.inl"
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "args/option_types.h++"
+#include "args/payload.h++"
+#include "args/types/args_hash_t.h++"
+#include "args/types/args_key_value_t.h++"
+#include "args/types/batch_options_t.h++"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <functional>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace nutsloop::args {
+
+class batch_result_t;
+
+/**
+ * Parses every command line of `lines` with the exact rules of
+ * Sequencer::parse(), spread over a pool of worker threads.
+ *
+ * Each line is laid out like argv, element 0 being the program name. Every
+ * worker reuses one Sequencer, built from the options' skip_digit_check,
+ * version and list_keys, and claims chunks of lines from a shared counter
+ * until none are left, so a worker that draws cheap lines simply takes more
+ * chunks. A line that throws is recorded as failed with its message; the
+ * other lines are unaffected and nothing is thrown.
+ *
+ * Only the final value of each key is kept, as in Sequencer::get_args().
+ */
+template <typename Sequencer>
+[[nodiscard]] batch_result_t parse_batch(std::span<const std::span<const char *const>> lines,
+                                         const batch_options_t &options = {});
+
+/**
+ * Parsed arguments of many command lines in columnar form.
+ *
+ * Keys and commands are interned once for the whole batch. Each line owns a
+ * contiguous run of entries, ordered by key id; an entry is a key id, the
+ * index of its value's alternative in args_key_value_t_ and a 64-bit
+ * payload. Strings live in one arena and the payload is their index there;
+ * bools are bits of a bitmap over entries; other values are the payload
+ * itself. Lines that failed to parse are marked in a bitmap and keep their
+ * error message instead of entries.
+ */
+class batch_result_t {
+public:
+  using key_id_t = std::uint32_t;
+
+  static constexpr key_id_t npos = static_cast<key_id_t>(-1);
+
+  // Number of command lines in the batch.
+  [[nodiscard]] std::size_t size() const noexcept { return line_commands_.size(); }
+
+  // Interned key table: a key id is an index into it.
+  [[nodiscard]] std::span<const std::string> keys() const noexcept { return keys_; }
+
+  [[nodiscard]] key_id_t key_id(std::string_view key) const;
+
+  // Leading command of `line`, empty when it has none.
+  [[nodiscard]] std::string_view command(std::size_t line) const;
+
+  [[nodiscard]] bool failed(std::size_t line) const { return test_bit_(failed_bits_, line); }
+
+  // Message of the exception that stopped `line`, empty when it parsed.
+  [[nodiscard]] std::string_view error(std::size_t line) const;
+
+  [[nodiscard]] std::size_t error_count() const noexcept { return errors_.size(); }
+
+  // Entries of `line` are [entry_begin(line), entry_end(line)).
+  [[nodiscard]] std::size_t entry_begin(const std::size_t line) const {
+    return line_offsets_[line];
+  }
+  [[nodiscard]] std::size_t entry_end(const std::size_t line) const {
+    return line_offsets_[line + 1];
+  }
+
+  [[nodiscard]] key_id_t entry_key(const std::size_t entry) const { return entry_keys_[entry]; }
+
+  // Index of the entry's alternative in args_key_value_t_.
+  [[nodiscard]] std::size_t entry_type(const std::size_t entry) const {
+    return entry_types_[entry];
+  }
+
+  [[nodiscard]] args_key_value_t_ value(std::size_t entry) const;
+
+  // Entry of `key` on `line`, or std::nullopt when the line does not have it.
+  [[nodiscard]] std::optional<std::size_t> find(std::size_t line, std::string_view key) const;
+
+  /**
+   * sequencer::get_arg<T> for one line: std::nullopt when the line does not
+   * have `key`, std::invalid_argument when its value is not a T.
+   */
+  template <OptionTypes T>
+  [[nodiscard]] std::optional<T> get_arg(std::size_t line, std::string_view key) const;
+
+private:
+  template <typename Sequencer>
+  friend batch_result_t parse_batch(std::span<const std::span<const char *const>> lines,
+                                    const batch_options_t &options);
+
+  std::vector<std::string> keys_;
+  std::unordered_map<std::string, key_id_t, args_hash_t, std::equal_to<>> key_ids_;
+  std::vector<std::string> commands_;
+  std::vector<key_id_t> line_commands_;
+
+  std::vector<std::uint64_t> line_offsets_;
+  std::vector<key_id_t> entry_keys_;
+  std::vector<std::uint8_t> entry_types_;
+  std::vector<std::uint64_t> entry_payloads_;
+  std::vector<std::uint64_t> bool_bits_;
+
+  std::vector<char> strings_;
+  std::vector<std::uint64_t> string_offsets_;
+
+  std::vector<std::uint64_t> failed_bits_;
+  std::vector<std::pair<std::size_t, std::string>> errors_;
+
+  [[nodiscard]] static bool test_bit_(const std::vector<std::uint64_t> &bits,
+                                      const std::size_t i) {
+    return (bits[i / 64] >> (i % 64)) & 1U;
+  }
+
+  [[nodiscard]] std::string_view string_at_(std::uint64_t index) const;
+};
+
+} // namespace nutsloop::args
+
+#include "args/inline/batch_result.inl"
+#include "args/inline/parse_batch.inl"
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "args.h++"
+#include "args/types/args_hash_t.h++"
+#include "args/types/args_key_value_t.h++"
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace nutsloop::args {
+
+/**
+ * Memo of the checkers a sequencer's get_option_* getters would build, so a
+ * checker that validates in its constructor (parses an address, opens a
+ * file) does so once per key instead of on every read.
+ *
+ * @code
+ * nutsloop::args::sequencer<addr_checker> parser(argc, argv);
+ * nutsloop::args::checker_cache checkers(parser);
+ * checkers.build(); // optional: validate every option now
+ *
+ * // request handler
+ * const addr_checker &bind = checkers.get("bind-addr");
+ * @endcode
+ *
+ * get() builds the checker of a key from the value the sequencer stores, as
+ * detail::make_checker_() does for the getters, the first time the key is
+ * read, and returns the same checker by const reference afterwards. A key
+ * the sequencer does not have gets the checker of nullptr, shared by all of
+ * them. Registered switches answer for their `enable-X`, `disable-X` and `X`
+ * forms like get_option_bool().
+ *
+ * Checkers are built from const lookups, so a cache must not be shared
+ * between threads until build() ran; after it, get() only reads. Checkers
+ * reflect the parse they were built from: call build() or clear() after the
+ * sequencer parses again. The sequencer must outlive the cache.
+ */
+template <typename Sequencer> class checker_cache {
+public:
+  using checker_t = typename Sequencer::checker_t;
+
+  explicit checker_cache(const Sequencer &sequencer) : sequencer_(sequencer) {}
+
+  /**
+   * Drops the checkers built so far and builds the one of every stored
+   * argument, of every given registered switch form and of absent keys, so
+   * that get() no longer builds anything.
+   *
+   * @throws whatever a checker's constructor throws for its value.
+   */
+  void build();
+
+  // The checker of `key`; see the class comment.
+  [[nodiscard]] const checker_t &get(std::string_view key) const;
+
+  // Drops every checker; get() builds them again on first access.
+  void clear() noexcept;
+
+  // Number of keys that have a checker, the one of absent keys excluded.
+  [[nodiscard]] std::size_t size() const noexcept { return checkers_.size(); }
+
+private:
+  const Sequencer &sequencer_;
+  mutable std::unordered_map<std::string, checker_t, args_hash_t, std::equal_to<>> checkers_;
+  mutable std::optional<checker_t> absent_;
+  bool built_{false};
+};
+
+} // namespace nutsloop::args
+
+#include "args/inline/checker_cache.inl"
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "args/types/command_options_t.h++"
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nutsloop::args {
+
+namespace detail {
+
+/**
+ * Perfect hash over the names of one command's subcommands.
+ *
+ * build() searches for a seed that sends every name to its own slot of a
+ * power-of-two table, so find() hashes the token once and compares it with
+ * at most one name.
+ */
+class command_index_t {
+public:
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  // Indexes `names`; find() returns positions in it.
+  void build(std::span<const std::string> names);
+
+  // Position of `name` in the names given to build(), or npos.
+  [[nodiscard]] std::size_t find(std::string_view name) const;
+
+private:
+  std::uint64_t seed_{0};
+  std::size_t mask_{0};
+  std::vector<std::string> slot_names_;
+  std::vector<std::size_t> slot_positions_;
+
+  [[nodiscard]] static std::uint64_t hash_(std::string_view name, std::uint64_t seed);
+};
+
+} // namespace detail
+
+/**
+ * Registry of subcommands, each with its own sequencer.
+ *
+ * @code
+ * nutsloop::args::command_tree<sequencer<checker>> commands;
+ * commands.add("remote add", [] { return command_options_t{.list_keys = ...}; });
+ * commands.add("build", [] { return command_options_t{.switches = ...}; });
+ * auto &parser = commands.parse(argc, argv); // parser.get_command() == "remote add"
+ * @endcode
+ *
+ * parse() follows the leading non-flag tokens of argv down the tree, one
+ * perfect-hash lookup per level, and hands the remaining tokens to the
+ * sequencer of the command it stops at. A command's options factory runs
+ * and its sequencer is built the first time that command is selected, so an
+ * invocation only pays for the command it runs; later parses reuse it.
+ *
+ * The root stands for argv without a command and is configured by the
+ * constructor's factory.
+ */
+template <typename Sequencer> class command_tree {
+public:
+  using factory_t = std::function<command_options_t()>;
+
+  explicit command_tree(factory_t root = {});
+
+  /**
+   * Registers the command at `path`, names separated by spaces ("remote
+   * add"); missing parents are added without options. Registering a path
+   * again replaces its factory and drops its sequencer.
+   *
+   * @throws std::invalid_argument if `path` has no name or a name starts
+   * with `-` or `@`.
+   */
+  command_tree &add(std::string_view path, factory_t factory = {});
+
+  /**
+   * Dispatches `argv` and parses the rest with the selected command's
+   * sequencer, whose get_command() is the full command path. The returned
+   * sequencer stays valid for the lifetime of the tree and holds the result
+   * until the same command is parsed again.
+   *
+   * @throws std::invalid_argument for a token where a subcommand is expected
+   * that does not name one, and on the sequencer's own parse errors.
+   */
+  Sequencer &parse(std::span<const char *const> argv);
+  Sequencer &parse(int argc, char *argv[]);
+
+private:
+  struct node_t_ {
+    std::string name;
+    std::string path;
+    factory_t factory;
+    std::vector<std::size_t> children;
+    detail::command_index_t index;
+    std::unique_ptr<Sequencer> sequencer;
+  };
+
+  std::vector<node_t_> nodes_;
+  bool indexed_{false};
+
+  // Rebuilds the perfect hash of every node after add().
+  void index_();
+
+  [[nodiscard]] Sequencer &sequencer_of_(node_t_ &node);
+};
+
+} // namespace nutsloop::args
+
+#include "args/inline/command_tree.inl"
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace nutsloop::args {
+
+enum class early_exit_kind_t : std::uint8_t { help, version };
+
+// A help or version request found in argv.
+struct early_exit_t {
+  early_exit_kind_t kind;
+  // Help topic ("help" when none was given); empty for a version request.
+  std::string_view topic;
+  // Position of the request in argv.
+  std::size_t index;
+};
+
+namespace detail {
+
+// The request `token` makes, with the rules of sequencer::parse(): a key of
+// `help` or one starting with `?` without a value, `help`, `h` or `?` with a
+// value, and `version` or `v` without a value.
+[[nodiscard]] constexpr std::optional<early_exit_t> match_early_exit_(const std::string_view token,
+                                                                      const std::size_t index) {
+  if (!token.starts_with('-') || token.ends_with('=')) {
+    return std::nullopt;
+  }
+
+  const std::string_view body = token.substr(token.starts_with("--") ? 2 : 1);
+  const auto equal_sign_pos = body.find('=');
+  const std::string_view key = body.substr(0, equal_sign_pos);
+
+  if (equal_sign_pos != std::string_view::npos) {
+    if (key == "help" || key == "h" || key == "?") {
+      return early_exit_t{early_exit_kind_t::help, body.substr(equal_sign_pos + 1), index};
+    }
+    return std::nullopt;
+  }
+
+  if (key.starts_with('?')) {
+    return early_exit_t{early_exit_kind_t::help, key.size() > 1 ? key.substr(1) : "help", index};
+  }
+  if (key == "help") {
+    return early_exit_t{early_exit_kind_t::help, key, index};
+  }
+  if (key == "version" || key == "v") {
+    return early_exit_t{early_exit_kind_t::version, {}, index};
+  }
+  return std::nullopt;
+}
+
+} // namespace detail
+
+/**
+ * Finds the first help or version request in `argv`, element 0 being the
+ * program name, without allocating or building a sequencer.
+ *
+ * @code
+ * if (const auto request = nutsloop::args::find_early_exit({argv, argc});
+ *     request && request->kind == nutsloop::args::early_exit_kind_t::version) {
+ *   std::println("{}", nutsloop::args::version_string_v<myapp::version>.view());
+ *   return 0;
+ * }
+ * @endcode
+ *
+ * A sequencer stops at the same token, but first throws on invalid tokens
+ * before it, and sees requests inside `@path` response files, which this
+ * scan does not open.
+ */
+[[nodiscard]] constexpr std::optional<early_exit_t>
+find_early_exit(const std::span<const char *const> argv) {
+  for (std::size_t i = 1; i < argv.size(); ++i) {
+    if (const auto request = detail::match_early_exit_(argv[i], i)) {
+      return request;
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace nutsloop::args
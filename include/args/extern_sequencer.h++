@@ -0,0 +1,41 @@
+#pragma once
+
+#include "args.h++"
+
+/**
+ * Explicit instantiation of sequencer, to compile its parser once instead
+ * of in every translation unit that uses it.
+ *
+ * NUTSLOOP_ARGS_EXTERN_SEQUENCER(...) declares that the members of
+ * sequencer<...> are instantiated in another translation unit, and
+ * NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER(...) instantiates them there:
+ *
+ * @code
+ * // myapp/args.h++, included instead of args.h++
+ * #include "args/extern_sequencer.h++"
+ * NUTSLOOP_ARGS_EXTERN_SEQUENCER(myapp::check, myapp::help);
+ *
+ * // myapp/args.c++, compiled once
+ * #include "myapp/args.h++"
+ * NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER(myapp::check, myapp::help);
+ * @endcode
+ *
+ * Member templates, such as get_arg<T>(), and members defined in the class
+ * are still instantiated where they are used.
+ */
+#define NUTSLOOP_ARGS_EXTERN_SEQUENCER(...)                                                    \
+  extern template class ::nutsloop::args::sequencer<__VA_ARGS__>
+#define NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER(...)                                               \
+  template class ::nutsloop::args::sequencer<__VA_ARGS__>
+
+// Sequencers over args_key_value_t_ compiled into args_lib; define
+// NUTSLOOP_ARGS_HEADER_ONLY to instantiate them in place instead.
+#if !defined(NUTSLOOP_ARGS_HEADER_ONLY)
+NUTSLOOP_ARGS_EXTERN_SEQUENCER(::nutsloop::args::args_key_value_t_);
+NUTSLOOP_ARGS_EXTERN_SEQUENCER(::nutsloop::args::args_key_value_t_, bool,
+                               ::nutsloop::args::parse_sync_t, ::nutsloop::args::args_flat_t);
+NUTSLOOP_ARGS_EXTERN_SEQUENCER(::nutsloop::args::args_key_value_t_, bool,
+                               ::nutsloop::args::parse_sync_t, ::nutsloop::args::pmr::args_t);
+NUTSLOOP_ARGS_EXTERN_SEQUENCER(::nutsloop::args::args_key_value_t_, bool,
+                               ::nutsloop::args::parse_threaded_t);
+#endif
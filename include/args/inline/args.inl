@@ -1,41 +1,84 @@
 #pragma once
 
-#include <thread>
+namespace nutsloop::args {
 
-#include <exception>
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::sequencer(
+    int argc, char *argv[], const skip_digit_check_t &skip_digit_check, const version_opt_t &version,
+    const list_keys_t &list_keys, const switches_t &switches, const typed_keys_t &typed_keys)
+    : sequencer(std::allocator_arg, std::pmr::get_default_resource(), argc, argv, skip_digit_check,
+                version, list_keys, switches, typed_keys) {}
 
-namespace nutsloop::args {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::sequencer(
+    std::allocator_arg_t, std::pmr::memory_resource *resource, int argc, char *argv[],
+    const skip_digit_check_t &skip_digit_check, const version_opt_t &version,
+    const list_keys_t &list_keys, const switches_t &switches, const typed_keys_t &typed_keys)
+    : sequencer(std::allocator_arg, resource, skip_digit_check, version, list_keys, switches,
+                typed_keys) {
 
-namespace detail {
-#if defined(__cpp_lib_jthread) && __cpp_lib_jthread >= 201911L
-using thread_t = std::jthread;
-#else
-using thread_t = std::thread;
-#endif
-} // namespace detail
+  if (argc <= 1) {
+    throw std::invalid_argument("no arguments provided");
+  }
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-sequencer<CheckerClass, HelperClass>::sequencer(int argc, char *argv[],
-                                      const skip_digit_check_t &skip_digit_check,
-                                      const version_opt_t &version) {
+  parse_with_policy_(std::span<const char *const>(argv, argc));
+}
 
-  version_ = version.value_or(version_t_{0, 0, 1, 0});
-  skip_digit_check_ = skip_digit_check.value_or(skip_digit_check_list_t_{});
-  std::exception_ptr thread_exception = nullptr;
-
-  detail::thread_t parse([argv, this, argc, &thread_exception] {
-    try {
-      this->parse_(argc, argv);
-    } catch (...) {
-      thread_exception = std::current_exception();
-    }
-  });
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::sequencer(
+    const skip_digit_check_t &skip_digit_check, const version_opt_t &version,
+    const list_keys_t &list_keys, const switches_t &switches, const typed_keys_t &typed_keys)
+    : sequencer(std::allocator_arg, std::pmr::get_default_resource(), skip_digit_check, version,
+                list_keys, switches, typed_keys) {}
 
-  parse.join();
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::sequencer(
+    std::allocator_arg_t, std::pmr::memory_resource *resource,
+    const skip_digit_check_t &skip_digit_check, const version_opt_t &version,
+    const list_keys_t &list_keys, const switches_t &switches, const typed_keys_t &typed_keys)
+    : resource_(recorder_.track(resource)),
+      // Storage types that are not allocator-aware (args_t, args_flat_t) are
+      // default-constructed.
+      arguments_(
+          std::make_obj_using_allocator<Storage>(std::pmr::polymorphic_allocator<>(resource_))),
+      values_(resource_), skip_digit_check_(resource_), list_keys_(resource_),
+      typed_keys_(resource_), keys_(resource_), switches_(resource_) {
 
-  if (thread_exception) {
-    std::rethrow_exception(thread_exception);
+  version_ = version.value_or(version_t_{0, 0, 1, 0});
+  version_string_ = version_string_t(version_);
+  if (skip_digit_check) {
+    for (const auto &key : *skip_digit_check) {
+      skip_digit_check_.emplace(key);
+    }
+  }
+  if (list_keys) {
+    for (const auto &key : *list_keys) {
+      list_keys_.emplace(key);
+    }
+  }
+  if (typed_keys) {
+    for (const auto &key : *typed_keys) {
+      typed_keys_.emplace(key);
+    }
+  }
+  if (switches) {
+    switches_.assign(*switches);
   }
 }
 
@@ -2,9 +2,14 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-std::string sequencer<CheckerClass, HelperClass>::argv_to_string_(const int argc, char *argv[]) {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+std::string
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::argv_to_string_(
+    const int argc, char *argv[]) {
 
   std::string result;
 
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+
+namespace nutsloop::args {
+
+inline batch_result_t::key_id_t batch_result_t::key_id(const std::string_view key) const {
+  const auto it = key_ids_.find(key);
+  return it == key_ids_.end() ? npos : it->second;
+}
+
+inline std::string_view batch_result_t::command(const std::size_t line) const {
+  const auto id = line_commands_[line];
+  return id == npos ? std::string_view() : std::string_view(commands_[id]);
+}
+
+inline std::string_view batch_result_t::error(const std::size_t line) const {
+  if (!failed(line)) {
+    return {};
+  }
+  const auto it =
+      std::ranges::lower_bound(errors_, line, {}, &decltype(errors_)::value_type::first);
+  return it->second;
+}
+
+inline std::string_view batch_result_t::string_at_(const std::uint64_t index) const {
+  return {strings_.data() + string_offsets_[index],
+          static_cast<std::size_t>(string_offsets_[index + 1] - string_offsets_[index])};
+}
+
+inline args_key_value_t_ batch_result_t::value(const std::size_t entry) const {
+  const auto payload = entry_payloads_[entry];
+  switch (entry_types_[entry]) {
+  case detail::key_value_index_<std::string>():
+    return std::string(string_at_(payload));
+  case detail::key_value_index_<bool>():
+    return test_bit_(bool_bits_, entry);
+  case detail::key_value_index_<std::nullptr_t>():
+    return nullptr;
+  case detail::key_value_index_<unsigned long long>():
+    return detail::from_payload_<unsigned long long>(payload);
+  case detail::key_value_index_<long long>():
+    return detail::from_payload_<long long>(payload);
+  case detail::key_value_index_<double>():
+    return detail::from_payload_<double>(payload);
+  case detail::key_value_index_<args_duration_t>():
+    return detail::from_payload_<args_duration_t>(payload);
+  default:
+    return detail::from_payload_<args_size_t>(payload);
+  }
+}
+
+inline std::optional<std::size_t> batch_result_t::find(const std::size_t line,
+                                                       const std::string_view key) const {
+  const auto id = key_id(key);
+  if (id == npos) {
+    return std::nullopt;
+  }
+  // entries of a line are sorted by key id.
+  const auto first = entry_keys_.begin() + static_cast<std::ptrdiff_t>(entry_begin(line));
+  const auto last = entry_keys_.begin() + static_cast<std::ptrdiff_t>(entry_end(line));
+  const auto it = std::lower_bound(first, last, id);
+  if (it == last || *it != id) {
+    return std::nullopt;
+  }
+  return static_cast<std::size_t>(it - entry_keys_.begin());
+}
+
+template <OptionTypes T>
+std::optional<T> batch_result_t::get_arg(const std::size_t line, const std::string_view key) const {
+  const auto entry = find(line, key);
+  if (!entry) {
+    return std::nullopt;
+  }
+
+  if (entry_types_[*entry] != detail::key_value_index_<T>()) {
+    throw std::invalid_argument(
+        std::format("--{} accept only {}", key, option_type_name_t<T>::get()));
+  }
+
+  if constexpr (std::same_as<T, std::string>) {
+    return std::string(string_at_(entry_payloads_[*entry]));
+  } else if constexpr (std::same_as<T, bool>) {
+    return test_bit_(bool_bits_, *entry);
+  } else {
+    return detail::from_payload_<T>(entry_payloads_[*entry]);
+  }
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <format>
+
+namespace nutsloop::args {
+
+template <typename Sequencer> void checker_cache<Sequencer>::build() {
+  clear();
+  for (const auto &[key, value] : sequencer_.get_args()) {
+    checkers_.emplace(std::string(key), detail::make_checker_<checker_t>(value));
+  }
+
+  const auto &switches = sequencer_.switches();
+  for (std::size_t bit = 0; bit < switches.size(); ++bit) {
+    const auto name = switches.name(bit);
+    for (auto form : {std::string(name), std::format("enable-{}", name),
+                      std::format("disable-{}", name)}) {
+      if (const auto flag = switches.find(form)) {
+        checkers_.emplace(std::move(form), checker_t(args_key_value_t_(*flag)));
+      }
+    }
+  }
+
+  absent_.emplace(args_key_value_t_(nullptr));
+  built_ = true;
+}
+
+template <typename Sequencer>
+const typename checker_cache<Sequencer>::checker_t &
+checker_cache<Sequencer>::get(const std::string_view key) const {
+  if (const auto it = checkers_.find(key); it != checkers_.end()) {
+    return it->second;
+  }
+
+  // after build() every present key has its checker: the rest are absent.
+  if (!built_) {
+    const auto &arguments = sequencer_.get_args();
+    if (const auto it = arguments.find(key); it != arguments.end()) {
+      return checkers_.emplace(std::string(key), detail::make_checker_<checker_t>(it->second))
+          .first->second;
+    }
+    if (const auto flag = sequencer_.switches().find(key)) {
+      return checkers_.emplace(std::string(key), checker_t(args_key_value_t_(*flag)))
+          .first->second;
+    }
+  }
+  if (!absent_) {
+    absent_.emplace(args_key_value_t_(nullptr));
+  }
+  return *absent_;
+}
+
+template <typename Sequencer> void checker_cache<Sequencer>::clear() noexcept {
+  checkers_.clear();
+  absent_.reset();
+  built_ = false;
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <bit>
+#include <utility>
+
+namespace nutsloop::args {
+
+namespace detail {
+
+inline std::uint64_t command_index_t::hash_(const std::string_view name,
+                                            const std::uint64_t seed) {
+  // FNV-1a from a seeded basis, folded so the low bits see the whole state.
+  std::uint64_t hash = 0xcbf29ce484222325ULL ^ (seed * 0x9e3779b97f4a7c15ULL);
+  for (const char c : name) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash ^ (hash >> 29);
+}
+
+inline void command_index_t::build(const std::span<const std::string> names) {
+  // start at a load factor of at most 1/2 and double the table when no seed
+  // in a bounded search separates every name.
+  std::size_t size = std::bit_ceil(std::max<std::size_t>(names.size() * 2, 1));
+  std::vector<bool> taken;
+  for (;; size *= 2) {
+    for (std::uint64_t seed = 0; seed < 256; ++seed) {
+      taken.assign(size, false);
+      bool separated = true;
+      for (const auto &name : names) {
+        const auto slot = hash_(name, seed) & (size - 1);
+        if (taken[slot]) {
+          separated = false;
+          break;
+        }
+        taken[slot] = true;
+      }
+      if (!separated) {
+        continue;
+      }
+
+      seed_ = seed;
+      mask_ = size - 1;
+      slot_names_.assign(size, {});
+      slot_positions_.assign(size, npos);
+      for (std::size_t i = 0; i < names.size(); ++i) {
+        const auto slot = hash_(names[i], seed) & mask_;
+        slot_names_[slot] = names[i];
+        slot_positions_[slot] = i;
+      }
+      return;
+    }
+  }
+}
+
+inline std::size_t command_index_t::find(const std::string_view name) const {
+  if (slot_names_.empty()) {
+    return npos;
+  }
+  const auto slot = hash_(name, seed_) & mask_;
+  return slot_positions_[slot] != npos && slot_names_[slot] == name ? slot_positions_[slot]
+                                                                     : npos;
+}
+
+} // namespace detail
+
+template <typename Sequencer> command_tree<Sequencer>::command_tree(factory_t root) {
+  nodes_.emplace_back().factory = std::move(root);
+}
+
+template <typename Sequencer>
+command_tree<Sequencer> &command_tree<Sequencer>::add(const std::string_view path,
+                                                      factory_t factory) {
+  std::size_t node = 0;
+  std::size_t names = 0;
+  for (std::size_t pos = 0; pos < path.size();) {
+    if (path[pos] == ' ') {
+      ++pos;
+      continue;
+    }
+    const auto end = std::min(path.find(' ', pos), path.size());
+    const auto name = path.substr(pos, end - pos);
+    pos = end;
+    ++names;
+
+    if (name.starts_with('-') || name.starts_with('@')) {
+      throw std::invalid_argument(
+          std::format("command `{}` cannot start with `-` or `@`", name));
+    }
+
+    std::size_t child = 0;
+    for (; child < nodes_[node].children.size(); ++child) {
+      if (nodes_[nodes_[node].children[child]].name == name) {
+        break;
+      }
+    }
+    if (child == nodes_[node].children.size()) {
+      const auto &parent_path = nodes_[node].path;
+      auto child_path =
+          parent_path.empty() ? std::string(name) : std::format("{} {}", parent_path, name);
+      auto &added = nodes_.emplace_back();
+      added.name = name;
+      added.path = std::move(child_path);
+      nodes_[node].children.push_back(nodes_.size() - 1);
+      indexed_ = false;
+    }
+    node = nodes_[node].children[child];
+  }
+
+  if (names == 0) {
+    throw std::invalid_argument("a command path needs at least one name");
+  }
+  nodes_[node].factory = std::move(factory);
+  nodes_[node].sequencer.reset();
+  return *this;
+}
+
+template <typename Sequencer>
+Sequencer &command_tree<Sequencer>::parse(const std::span<const char *const> argv) {
+  if (!indexed_) {
+    index_();
+  }
+
+  std::size_t node = 0;
+  std::size_t next = 1;
+  for (; next < argv.size(); ++next) {
+    const std::string_view token = argv[next];
+    if (token.empty() || token.starts_with('-') || token.starts_with('@')) {
+      break;
+    }
+    const auto &current = nodes_[node];
+    const auto child = current.index.find(token);
+    if (child == detail::command_index_t::npos) {
+      // a command without subcommands leaves the token to its sequencer.
+      if (current.children.empty()) {
+        break;
+      }
+      throw std::invalid_argument(
+          current.path.empty() ? std::format("unknown command `{}`", token)
+                               : std::format("unknown command `{}` for `{}`", token, current.path));
+    }
+    node = current.children[child];
+  }
+
+  auto &selected = sequencer_of_(nodes_[node]);
+  // element 0 is skipped by the sequencer: the last command name, or argv[0].
+  selected.parse(nodes_[node].path, argv.subspan(next - 1));
+  return selected;
+}
+
+template <typename Sequencer>
+Sequencer &command_tree<Sequencer>::parse(const int argc, char *argv[]) {
+  return parse(std::span<const char *const>(argv, argc < 0 ? 0 : argc));
+}
+
+template <typename Sequencer> void command_tree<Sequencer>::index_() {
+  std::vector<std::string> names;
+  for (auto &node : nodes_) {
+    names.clear();
+    for (const auto child : node.children) {
+      names.push_back(nodes_[child].name);
+    }
+    node.index.build(names);
+  }
+  indexed_ = true;
+}
+
+template <typename Sequencer> Sequencer &command_tree<Sequencer>::sequencer_of_(node_t_ &node) {
+  if (!node.sequencer) {
+    const auto options = node.factory ? node.factory() : command_options_t{};
+    node.sequencer = std::make_unique<Sequencer>(options.skip_digit_check, options.version,
+                                                 options.list_keys, options.switches,
+                                                 options.typed_keys);
+  }
+  return *node.sequencer;
+}
+
+} // namespace nutsloop::args
@@ -2,9 +2,13 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-bool sequencer<CheckerClass, HelperClass>::does_skip_digit_check_() const {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+bool sequencer<CheckerClass, HelperClass, ParsePolicy, Storage,
+               Instrumentation>::does_skip_digit_check_() const {
   // Assuming skip_digit_check_ and key_ are members
   return skip_digit_check_.contains(key_);
 }
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+
+namespace nutsloop::args {
+
+namespace detail {
+
+/**
+ * Returns the next argument of a response file and advances `cursor`.
+ *
+ * Arguments are separated by whitespace. Single or double quotes group
+ * characters (including whitespace) into one argument, and a backslash
+ * escapes the next character, as in GCC response files. Quotes and
+ * backslashes are removed by compacting the argument in place inside
+ * `buffer`, so the returned view points into the buffer and nothing is
+ * copied; bytes are only written when an argument contains quotes or
+ * escapes.
+ *
+ * Returns std::nullopt once the buffer is exhausted.
+ */
+inline std::optional<std::string_view> next_response_token_(std::span<char> buffer,
+                                                            std::size_t &cursor) {
+  const auto is_space = [](const char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+  };
+
+  while (cursor < buffer.size() && is_space(buffer[cursor])) {
+    ++cursor;
+  }
+  if (cursor == buffer.size()) {
+    return std::nullopt;
+  }
+
+  char *const begin = buffer.data() + cursor;
+  char *write = begin;
+  char quote = '\0';
+
+  const auto keep = [&](const std::size_t at) {
+    // only touch the buffer once a quote or escape has shifted the argument.
+    if (write != buffer.data() + at) {
+      *write = buffer[at];
+    }
+    ++write;
+  };
+
+  for (; cursor < buffer.size(); ++cursor) {
+    const char c = buffer[cursor];
+
+    if (c == '\\' && cursor + 1 < buffer.size()) {
+      keep(++cursor);
+    } else if (quote != '\0') {
+      if (c == quote) {
+        quote = '\0';
+      } else {
+        keep(cursor);
+      }
+    } else if (c == '"' || c == '\'') {
+      quote = c;
+    } else if (is_space(c)) {
+      break;
+    } else {
+      keep(cursor);
+    }
+  }
+
+  if (quote != '\0') {
+    throw std::invalid_argument(
+        std::format("unterminated {} quote in response file argument: {}", quote,
+                    std::string_view(begin, static_cast<std::size_t>(write - begin))));
+  }
+
+  return std::string_view(begin, static_cast<std::size_t>(write - begin));
+}
+
+} // namespace detail
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+bool
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::expand_response_file_(
+    const std::string &path, mapped_file_t &file, response_file_stack_t_ &response_files) {
+
+  if (std::ranges::find(response_files, file.identity()) != response_files.end()) {
+    throw std::invalid_argument(std::format("@{}: response file includes itself", path));
+  }
+  response_files.push_back(file.identity());
+  recorder_.count(detail::arg_kind_t::response_file);
+
+  // tokens are views into the mapping; parse_token_ stores owned copies
+  // before the mapping is released.
+  bool keep_parsing = true;
+  std::size_t cursor = 0;
+  while (keep_parsing) {
+    const auto token = detail::next_response_token_(file.data(), cursor);
+    if (!token) {
+      break;
+    }
+    keep_parsing = parse_token_(*token, response_files);
+  }
+
+  response_files.pop_back();
+  return keep_parsing;
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+std::optional<bool>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::find_switch_(
+    const std::string_view key) const {
+  return switches_.find(key);
+}
+
+} // namespace nutsloop::args
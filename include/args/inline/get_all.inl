@@ -0,0 +1,24 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+template <OptionTypes T>
+[[nodiscard]] std::span<const args_value_view_t<T>>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::get_all(
+    const std::string_view key) const {
+  const auto values = values_.template values<T>(key);
+
+  if (values.size() != values_.count(key)) {
+    throw std::invalid_argument(
+        std::format("--{} accept only {}", key, option_type_name_t<T>::get()));
+  }
+
+  return values;
+}
+
+} // namespace nutsloop::args
@@ -2,14 +2,26 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
 template <OptionTypes T>
 [[nodiscard]] std::optional<T>
-sequencer<CheckerClass, HelperClass>::get_arg(const std::string &key) const {
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::get_arg(
+    const std::string_view key) const {
   const auto it = arguments_.find(key);
   if (it == arguments_.end()) {
-    return std::nullopt;
+    const auto flag = find_switch_(key);
+    if (!flag) {
+      return std::nullopt;
+    }
+    if constexpr (std::same_as<T, bool>) {
+      return *flag;
+    }
+    throw std::invalid_argument(
+        std::format("--{} accept only {}", key, option_type_name_t<T>::get()));
   }
 
   if (auto value = std::get_if<T>(&it->second)) {
@@ -17,7 +29,37 @@ sequencer<CheckerClass, HelperClass>::get_arg(const std::string &key) const {
   }
 
   throw std::invalid_argument(
-      std::format("--{} accept only {}", option_type_name_t<T>::get(), key));
+      std::format("--{} accept only {}", key, option_type_name_t<T>::get()));
+}
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+template <OptionTypes T>
+[[nodiscard]] std::optional<T>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::get_arg(
+    const args_key_t key) const {
+  const auto *found = find_key_(key);
+  if (found == nullptr) {
+    const auto flag = find_switch_(keys_.name(key));
+    if (!flag) {
+      return std::nullopt;
+    }
+    if constexpr (std::same_as<T, bool>) {
+      return *flag;
+    }
+    throw std::invalid_argument(std::format("--{} accept only {}", keys_.name(key),
+                                            option_type_name_t<T>::get()));
+  }
+
+  if (auto value = std::get_if<T>(found)) {
+    return *value;
+  }
+
+  throw std::invalid_argument(std::format("--{} accept only {}", keys_.name(key),
+                                          option_type_name_t<T>::get()));
 }
 
 } // namespace nutsloop::args
@@ -2,11 +2,15 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> &&
-           (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-           HelperClass sequencer<CheckerClass, HelperClass>::get_help(std::string argument)
-             requires ArgsHelper<HelperClass>
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+HelperClass
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::get_help(
+    std::string argument)
+  requires ArgsHelper<HelperClass>
 {
   return HelperClass(argument, version_);
 }
@@ -2,12 +2,17 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-CheckerClass sequencer<CheckerClass, HelperClass>::get_option_bool(const std::string &key) const {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+CheckerClass
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::get_option_bool(
+    const std::string_view key) const {
   if (const auto it = arguments_.find(key); it != arguments_.end()) {
     if (std::holds_alternative<bool>(it->second)) {
-      return CheckerClass(std::get<bool>(it->second));
+      return detail::make_checker_<CheckerClass>(it->second);
     }
 
     std::string boolean = "`true`";
@@ -20,7 +25,10 @@ CheckerClass sequencer<CheckerClass, HelperClass>::get_option_bool(const std::st
     throw std::invalid_argument(std::format(
         "--{} is a simple switch that returns {} and should omit the `=` sign.", key, boolean));
   }
-  return CheckerClass(nullptr);
+  if (const auto flag = find_switch_(key)) {
+    return CheckerClass(args_key_value_t_(*flag));
+  }
+  return CheckerClass(args_key_value_t_(nullptr));
 }
 
 } // namespace nutsloop::args
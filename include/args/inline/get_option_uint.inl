@@ -2,16 +2,21 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-CheckerClass sequencer<CheckerClass, HelperClass>::get_option_uint(const std::string &key) const {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+CheckerClass
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::get_option_uint(
+    const std::string_view key) const {
   if (const auto it = arguments_.find(key); it != arguments_.end()) {
     if (std::holds_alternative<unsigned long long>(it->second)) {
-      return CheckerClass(std::get<unsigned long long>(it->second));
+      return detail::make_checker_<CheckerClass>(it->second);
     }
     throw std::invalid_argument(std::format("--{} accept only integer, in the range of int.", key));
   }
-  return CheckerClass(nullptr);
+  return CheckerClass(args_key_value_t_(nullptr));
 }
 
 } // namespace nutsloop::args
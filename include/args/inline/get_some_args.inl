@@ -2,15 +2,22 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-args_t
-sequencer<CheckerClass, HelperClass>::get_some_args(const std::vector<std::string> &selection) const {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+Storage
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::get_some_args(
+    const std::vector<std::string> &selection) const {
 
-  args_t some_arguments;
+  auto some_arguments =
+      std::make_obj_using_allocator<Storage>(std::pmr::polymorphic_allocator<>(resource_));
   for (auto &selected : selection) {
     if (arguments_.contains(selected)) {
       some_arguments[selected] = arguments_.at(selected);
+    } else if (const auto flag = find_switch_(selected)) {
+      some_arguments[selected] = args_key_value_t_(*flag);
     }
   }
 
@@ -2,10 +2,24 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-bool sequencer<CheckerClass, HelperClass>::has(const std::string &key) const {
-  return arguments_.contains(key);
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+bool sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::has(
+    const std::string_view key) const {
+  return arguments_.contains(key) || find_switch_(key).has_value();
+}
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+bool sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::has(
+    const args_key_t key) const {
+  return find_key_(key) != nullptr || find_switch_(keys_.name(key)).has_value();
 }
 
 } // namespace nutsloop::args
\ No newline at end of file
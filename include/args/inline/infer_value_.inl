@@ -0,0 +1,19 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+detail::inferred_value_t
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::infer_value_() const {
+  if (does_skip_digit_check_()) {
+    return {};
+  }
+  // the value is converted once here and stored unboxed in the variant.
+  return detail::infer_value_(value_, typed_keys_.contains(key_));
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+args_key_t
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::key(
+    const std::string_view name) {
+  return keys_.intern(name, arguments_);
+}
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+const args_key_value_t_ *
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::find_key_(
+    const args_key_t key) const {
+  if (!keys_.contains(key)) {
+    throw std::invalid_argument(std::format("key handle {} was not issued by this sequencer",
+                                            key.index()));
+  }
+  return keys_.find(key, arguments_);
+}
+
+} // namespace nutsloop::args
@@ -2,11 +2,16 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-bool sequencer<CheckerClass, HelperClass>::match_enabling_switch_() {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+bool sequencer<CheckerClass, HelperClass, ParsePolicy, Storage,
+               Instrumentation>::match_enabling_switch_() {
   if (key_.find("enable-") != std::string::npos) {
-    arguments_[key_] = true;
+    recorder_.count(detail::arg_kind_t::enable_switch);
+    store_(true);
     return true;
   }
   return false;
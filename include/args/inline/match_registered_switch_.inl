@@ -0,0 +1,20 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+bool sequencer<CheckerClass, HelperClass, ParsePolicy, Storage,
+               Instrumentation>::match_registered_switch_() {
+  // registered switches only flip a bit; they never reach `arguments_`.
+  if (switches_.empty() || !switches_.set(key_)) {
+    return false;
+  }
+  recorder_.count(detail::arg_kind_t::registered_switch);
+  return true;
+}
+
+} // namespace nutsloop::args
@@ -2,10 +2,15 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-void sequencer<CheckerClass, HelperClass>::match_truthy_switch_() {
-  arguments_[key_] = true;
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void sequencer<CheckerClass, HelperClass, ParsePolicy, Storage,
+               Instrumentation>::match_truthy_switch_() {
+  recorder_.count(detail::arg_kind_t::truthy_switch);
+  store_(true);
 }
 
 } // namespace nutsloop::args
\ No newline at end of file
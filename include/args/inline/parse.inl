@@ -0,0 +1,46 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::parse(
+    const std::span<const char *const> argv) {
+
+  reset();
+  if (argv.size() > 1) {
+    parse_with_policy_(argv);
+  }
+}
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::parse(const int argc,
+                                                                      char *argv[]) {
+  parse(std::span<const char *const>(argv, argc < 0 ? 0 : argc));
+}
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::parse(
+    const std::string_view command, const std::span<const char *const> argv) {
+
+  reset();
+  command_ = command;
+  expect_command_ = false;
+  if (argv.size() > 1) {
+    parse_with_policy_(argv);
+  }
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,147 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+bool
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::parse_arg_(
+    const std::string_view arg) {
+  arg_ = arg;
+
+  // the first token, from argv or from a leading response file, may be the command.
+  if (expect_command_) {
+    expect_command_ = false;
+    if (!arg_.starts_with('-')) {
+      command_ = arg_;
+      return true;
+    }
+  }
+
+  if (!arg_.starts_with("--") && !arg_.starts_with("-")) {
+    throw std::invalid_argument(std::format("flags start with `--` or `-`. try --{}", arg_));
+  }
+
+  if (arg_.ends_with("=")) {
+    throw std::invalid_argument(std::format("{}??? does it require a value? if yes try -> "
+                                            "{}something\nif not, omit the `=` -> {}",
+                                            arg_, arg_, arg_.substr(0, arg_.size() - 1)));
+  }
+
+  // help and version requests stop parsing. parse_() finds the ones in argv
+  // before parsing; this catches those that come from a response file.
+  if (const auto request = detail::match_early_exit_(arg_, 0)) {
+    store_early_exit_(*request);
+    return false;
+  }
+
+  {
+    [[maybe_unused]] const auto timer = recorder_.time(parse_phase_t::split);
+    process_dashes_();
+    equal_sign_pos_ = arg_.find('=');
+    key_ = strip_dashes_();
+  }
+
+  /// Handles the case where the input key-value pair does not contain an '=' sign,
+  /// indicating a special processing mode for standalone keys.
+  ///
+  /// Behavior:
+  /// 1. **Help and Version**:
+  ///    - Help (`--help`, `--?topic`) and version (`--version`, `-v`) requests
+  ///    are matched by `detail::match_early_exit_()` before the key is
+  ///    stripped, stored by `store_early_exit_()`, and stop parsing (returns
+  ///    `false`).
+  ///
+  /// 2. **Toggle / Switch Handling**:
+  ///    - The following methods are used to handle switches or feature toggles:
+  ///      - `match_enabling_switch_()`: Checks if the key contains "enable". If
+  ///      found, the key is
+  ///        stored in `arguments_` with a value of `true`, and processing continues.
+  ///      - `match_disabling_switch_()`: Checks if the key contains "disable". If
+  ///      found, the key
+  ///        is stored in `arguments_` with a value of `false`, and processing
+  ///        continues.
+  ///      - `simple_switch_()`: For all other cases, stores the key in `arguments_`
+  ///      with
+  ///        a value of `true`. This acts as a generic toggle for standalone keys.
+  ///    Each switch-handling method is invoked in order, and parsing proceeds to
+  ///    the next token after successful processing (returns `true`).
+  ///
+  /// 3. **Default Processing**:
+  ///    - If none of the switch-handling conditions are met,
+  ///      parsing proceeds to the next token without modification.
+  ///
+  /// Notes:
+  /// - The absence of '=' is indicated by `equal_sign_pos_ == std::string::npos`.
+  /// - The processed key-value pairs are stored in the `arguments_` map for further
+  /// handling. Checks if the `equal_sign_pos_` indicates the absence of an equal sign
+  /// in the input string.
+  if (equal_sign_pos_ == std::string::npos) {
+
+    /// `--` names no key.
+    if (key_.empty()) {
+      throw std::invalid_argument(std::format("`{}` has no key. try --key", arg_));
+    }
+
+    /// Registered switches are kept as bits in `switches_`, see
+    /// `match_registered_switch_`. If matched, moves on to the next token.
+    if (this->match_registered_switch_()) return true;
+
+    /// Attempts to enable a specific feature or mode using the
+    /// `match_enabling_switch_` method. If successful, moves on to the next
+    /// token.
+    if (this->match_enabling_switch_()) return true;
+
+    /// Attempts to disable a specific feature or mode using the
+    /// `match_disabling_switch_` method. If successful, moves on to the next
+    /// token.
+    if (this->match_disabling_switch_()) return true;
+
+    /// Handles cases for simple toggles using the `match_truthy_switch_` method.
+    this->match_truthy_switch_();
+
+    /// Proceeds to the next token when no specific condition is met.
+    return true;
+  }
+
+  /// @brief Extracts the substring from `arg_` starting right after the position of
+  /// `equal_sign_pos_` and assigns it to `value_`.
+  ///
+  /// This operation is often used for parsing strings where key-value pairs are
+  /// separated by an equals sign ('='). For example, if `arg_` contains "key=value",
+  /// and `equal_sign_pos_` points to the position of '=', then `value_` will be
+  /// assigned "value".
+  ///
+  /// @note Assumes that `equal_sign_pos_ + 1` is a valid index in `arg_`.
+  value_ = arg_.substr(equal_sign_pos_ + 1);
+
+  // list keys are split on ',' into one element per item.
+  if (list_keys_.contains(key_)) {
+    store_list_();
+    return true;
+  }
+
+  // numbers, durations and sizes are stored as their own type, anything else as a string.
+  const auto typed_value = [this] {
+    [[maybe_unused]] const auto timer = recorder_.time(parse_phase_t::infer);
+    return infer_value_();
+  }();
+  std::visit(
+      [this]<typename T>(const T &typed) {
+        if constexpr (std::same_as<T, std::monostate>) {
+          recorder_.count(detail::arg_kind_t::string_value);
+          store_(value_);
+        } else {
+          recorder_.count(detail::arg_kind_t::numeric_value);
+          store_(typed);
+        }
+      },
+      typed_value);
+
+  return true;
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+namespace nutsloop::args {
+
+namespace detail {
+
+// One chunk of lines as a worker parsed it: keys and commands are interned
+// per chunk, so chunks need no shared state until they are merged in order.
+struct batch_chunk_t_ {
+  using id_t = batch_result_t::key_id_t;
+  using intern_map_t = std::unordered_map<std::string, id_t, args_hash_t, std::equal_to<>>;
+
+  std::size_t first_line{0};
+  std::size_t last_line{0};
+
+  std::vector<std::string> keys;
+  intern_map_t key_ids;
+  std::vector<std::string> commands;
+  intern_map_t command_ids;
+
+  std::vector<id_t> line_commands;
+  std::vector<std::uint32_t> line_entry_counts;
+  std::vector<id_t> entry_keys;
+  std::vector<std::uint8_t> entry_types;
+  std::vector<std::uint64_t> entry_payloads;
+  std::vector<char> strings;
+  std::vector<std::uint64_t> string_offsets;
+  std::vector<std::pair<std::size_t, std::string>> errors;
+
+  // Set while merging: chunk ids to batch ids, and where the chunk's
+  // entries and strings start in the batch columns.
+  std::vector<id_t> key_remap;
+  std::vector<id_t> command_remap;
+  std::uint64_t entry_base{0};
+  std::uint64_t string_base{0};
+  std::uint64_t string_byte_base{0};
+
+  static id_t intern(std::vector<std::string> &table, intern_map_t &ids,
+                     const std::string_view value) {
+    if (const auto it = ids.find(value); it != ids.end()) {
+      return it->second;
+    }
+    const auto id = static_cast<id_t>(table.size());
+    table.emplace_back(value);
+    ids.emplace(table.back(), id);
+    return id;
+  }
+
+  void add_value(const args_key_value_t_ &value) {
+    entry_types.push_back(static_cast<std::uint8_t>(value.index()));
+    entry_payloads.push_back(std::visit(
+        [this]<typename T>(const T &alternative) -> std::uint64_t {
+          if constexpr (std::same_as<T, std::string>) {
+            string_offsets.push_back(strings.size());
+            strings.insert(strings.end(), alternative.begin(), alternative.end());
+            return string_offsets.size() - 1;
+          } else if constexpr (std::same_as<T, std::nullptr_t>) {
+            return 0;
+          } else {
+            return to_payload_(alternative);
+          }
+        },
+        value));
+  }
+};
+
+// Runs `work` on `threads` threads, the calling thread included, and
+// rethrows the first exception one of them let escape.
+template <typename Work> void run_batch_workers_(const std::size_t threads, Work &&work) {
+  std::exception_ptr failure = nullptr;
+  std::atomic_flag failed;
+  const auto guarded = [&] {
+    try {
+      work();
+    } catch (...) {
+      if (!failed.test_and_set()) {
+        failure = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (std::size_t i = 1; i < threads; ++i) {
+    workers.emplace_back(guarded);
+  }
+  guarded();
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  if (failure) {
+    std::rethrow_exception(failure);
+  }
+}
+
+} // namespace detail
+
+template <typename Sequencer>
+batch_result_t parse_batch(const std::span<const std::span<const char *const>> lines,
+                           const batch_options_t &options) {
+  using chunk_t = detail::batch_chunk_t_;
+  constexpr auto npos = batch_result_t::npos;
+
+  const std::size_t chunk_size = std::max<std::size_t>(options.chunk_size, 1);
+  const std::size_t chunk_count = (lines.size() + chunk_size - 1) / chunk_size;
+  std::size_t threads =
+      options.threads != 0 ? options.threads : std::thread::hardware_concurrency();
+  threads = std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(chunk_count, 1));
+
+  std::vector<chunk_t> chunks(chunk_count);
+  for (std::size_t c = 0; c < chunk_count; ++c) {
+    chunks[c].first_line = c * chunk_size;
+    chunks[c].last_line = std::min(lines.size(), (c + 1) * chunk_size);
+  }
+
+  // 1. parse: workers claim chunks until none are left.
+  std::atomic<std::size_t> next_chunk{0};
+  detail::run_batch_workers_(threads, [&] {
+    Sequencer parser(options.skip_digit_check, options.version, options.list_keys, std::nullopt,
+                     options.typed_keys);
+    for (auto c = next_chunk.fetch_add(1, std::memory_order_relaxed); c < chunk_count;
+         c = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+      auto &chunk = chunks[c];
+      for (auto line = chunk.first_line; line < chunk.last_line; ++line) {
+        try {
+          parser.parse(lines[line]);
+        } catch (const std::exception &e) {
+          chunk.errors.emplace_back(line, e.what());
+          chunk.line_commands.push_back(npos);
+          chunk.line_entry_counts.push_back(0);
+          continue;
+        }
+
+        const auto &command = parser.get_command();
+        chunk.line_commands.push_back(
+            command.empty() ? npos : chunk_t::intern(chunk.commands, chunk.command_ids, command));
+
+        std::uint32_t count = 0;
+        for (const auto &[key, value] : parser.get_args()) {
+          chunk.entry_keys.push_back(chunk_t::intern(chunk.keys, chunk.key_ids, key));
+          chunk.add_value(value);
+          ++count;
+        }
+        chunk.line_entry_counts.push_back(count);
+      }
+    }
+  });
+
+  // 2. merge the chunk tables in line order, so ids do not depend on timing.
+  batch_result_t result;
+  std::uint64_t entries = 0;
+  std::uint64_t strings = 0;
+  std::uint64_t string_bytes = 0;
+  for (auto &chunk : chunks) {
+    for (const auto &key : chunk.keys) {
+      chunk.key_remap.push_back(chunk_t::intern(result.keys_, result.key_ids_, key));
+    }
+    chunk_t::intern_map_t command_ids;
+    for (const auto &command : chunk.commands) {
+      chunk.command_remap.push_back(chunk_t::intern(result.commands_, command_ids, command));
+    }
+    chunk.entry_base = entries;
+    chunk.string_base = strings;
+    chunk.string_byte_base = string_bytes;
+    entries += chunk.entry_keys.size();
+    strings += chunk.string_offsets.size();
+    string_bytes += chunk.strings.size();
+    for (auto &error : chunk.errors) {
+      result.errors_.push_back(std::move(error));
+    }
+  }
+
+  result.line_commands_.resize(lines.size());
+  result.line_offsets_.resize(lines.size() + 1);
+  result.line_offsets_.back() = entries;
+  result.entry_keys_.resize(entries);
+  result.entry_types_.resize(entries);
+  result.entry_payloads_.resize(entries);
+  result.bool_bits_.assign((entries + 63) / 64, 0);
+  result.strings_.resize(string_bytes);
+  result.string_offsets_.resize(strings + 1);
+  result.string_offsets_.back() = string_bytes;
+  result.failed_bits_.assign((lines.size() + 63) / 64, 0);
+  for (const auto &error : result.errors_) {
+    result.failed_bits_[error.first / 64] |= std::uint64_t{1} << (error.first % 64);
+  }
+
+  // 3. scatter every chunk into the batch columns, entries sorted by key id.
+  next_chunk.store(0, std::memory_order_relaxed);
+  detail::run_batch_workers_(threads, [&] {
+    std::vector<std::uint32_t> order;
+    for (auto c = next_chunk.fetch_add(1, std::memory_order_relaxed); c < chunk_count;
+         c = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+      const auto &chunk = chunks[c];
+
+      if (!chunk.strings.empty()) {
+        std::memcpy(result.strings_.data() + chunk.string_byte_base, chunk.strings.data(),
+                    chunk.strings.size());
+      }
+      for (std::size_t s = 0; s < chunk.string_offsets.size(); ++s) {
+        result.string_offsets_[chunk.string_base + s] =
+            chunk.string_byte_base + chunk.string_offsets[s];
+      }
+
+      std::uint32_t local = 0;
+      auto entry = chunk.entry_base;
+      for (auto line = chunk.first_line; line < chunk.last_line; ++line) {
+        const auto index = line - chunk.first_line;
+        const auto command = chunk.line_commands[index];
+        result.line_commands_[line] = command == npos ? npos : chunk.command_remap[command];
+        result.line_offsets_[line] = entry;
+
+        const auto count = chunk.line_entry_counts[index];
+        order.resize(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+          order[i] = local + i;
+        }
+        std::ranges::sort(order, {}, [&chunk](const std::uint32_t i) {
+          return chunk.key_remap[chunk.entry_keys[i]];
+        });
+
+        for (const auto i : order) {
+          const auto type = chunk.entry_types[i];
+          auto payload = chunk.entry_payloads[i];
+          if (type == detail::key_value_index_<std::string>()) {
+            payload += chunk.string_base;
+          } else if (type == detail::key_value_index_<bool>() && payload != 0) {
+            // neighbouring chunks can share a bitmap word.
+            std::atomic_ref<std::uint64_t>(result.bool_bits_[entry / 64])
+                .fetch_or(std::uint64_t{1} << (entry % 64), std::memory_order_relaxed);
+          }
+          result.entry_keys_[entry] = chunk.key_remap[chunk.entry_keys[i]];
+          result.entry_types_[entry] = type;
+          result.entry_payloads_[entry] = payload;
+          ++entry;
+        }
+        local += count;
+      }
+    }
+  });
+
+  return result;
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <thread>
+
+#include <exception>
+
+namespace nutsloop::args {
+
+namespace detail {
+#if defined(__cpp_lib_jthread) && __cpp_lib_jthread >= 201911L
+using thread_t = std::jthread;
+#else
+using thread_t = std::thread;
+#endif
+} // namespace detail
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::parse_with_policy_(
+    const std::span<const char *const> argv) {
+
+  if constexpr (std::same_as<ParsePolicy, parse_sync_t>) {
+    // exceptions from parse_() propagate straight to the caller.
+    parse_(argv);
+  } else if (argv.size() > 1 && detail::match_early_exit_(argv[1], 1)) {
+    // a request in the first argument is all parse_() will look at: not
+    // worth a thread.
+    parse_(argv);
+  } else {
+    std::exception_ptr thread_exception = nullptr;
+
+    detail::thread_t parse([argv, this, &thread_exception] {
+      try {
+        this->parse_(argv);
+      } catch (...) {
+        thread_exception = std::current_exception();
+      }
+    });
+
+    parse.join();
+
+    if (thread_exception) {
+      std::rethrow_exception(thread_exception);
+    }
+  }
+}
+
+} // namespace nutsloop::args
@@ -2,9 +2,13 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-void sequencer<CheckerClass, HelperClass>::process_dashes_() {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::process_dashes_() {
   if (arg_.at(0) == '-') {
     if (arg_.at(1) == '-') {
       is_single_dash_ = false;
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+
+namespace nutsloop::args {
+
+template <typename T>
+published_t<T>::reader_t::reader_t(reader_t &&other) noexcept
+    : owner_(std::exchange(other.owner_, nullptr)), slot_(std::exchange(other.slot_, nullptr)),
+      cached_(std::exchange(other.cached_, nullptr)) {}
+
+template <typename T>
+typename published_t<T>::reader_t &published_t<T>::reader_t::operator=(reader_t &&other) noexcept {
+  if (this != &other) {
+    release_();
+    owner_ = std::exchange(other.owner_, nullptr);
+    slot_ = std::exchange(other.slot_, nullptr);
+    cached_ = std::exchange(other.cached_, nullptr);
+  }
+  return *this;
+}
+
+template <typename T> published_t<T>::reader_t::~reader_t() { release_(); }
+
+template <typename T> const T *published_t<T>::reader_t::get() {
+  const auto *node = owner_->current_.load(std::memory_order_acquire);
+  if (node != cached_) [[unlikely]] {
+    // announce the node, then check it is still current: a publish() that
+    // replaced it after the announcement sees the slot and keeps it alive.
+    for (;;) {
+      slot_->hazard.store(node, std::memory_order_seq_cst);
+      const auto *current = owner_->current_.load(std::memory_order_seq_cst);
+      if (current == node) {
+        break;
+      }
+      node = current;
+    }
+    cached_ = node;
+  }
+  return node == nullptr ? nullptr : node->value.get();
+}
+
+template <typename T> std::uint64_t published_t<T>::reader_t::generation() const noexcept {
+  return cached_ == nullptr ? 0 : cached_->generation;
+}
+
+template <typename T> void published_t<T>::reader_t::release_() noexcept {
+  if (slot_ == nullptr) {
+    return;
+  }
+  slot_->hazard.store(nullptr, std::memory_order_release);
+  const std::lock_guard lock(owner_->mutex_);
+  slot_->used = false;
+  slot_ = nullptr;
+  cached_ = nullptr;
+}
+
+template <typename T> published_t<T>::~published_t() {
+  delete current_.load(std::memory_order_relaxed);
+  for (const auto *node : retired_) {
+    delete node;
+  }
+}
+
+template <typename T> std::uint64_t published_t<T>::publish(std::unique_ptr<const T> value) {
+  const std::lock_guard lock(mutex_);
+  const auto generation = generation_.load(std::memory_order_relaxed) + 1;
+  const auto *replaced =
+      current_.exchange(new node_t_{std::move(value), generation}, std::memory_order_seq_cst);
+  generation_.store(generation, std::memory_order_release);
+  if (replaced != nullptr) {
+    retired_.push_back(replaced);
+  }
+  reclaim_();
+  return generation;
+}
+
+template <typename T> std::size_t published_t<T>::reclaim() {
+  const std::lock_guard lock(mutex_);
+  reclaim_();
+  return retired_.size();
+}
+
+template <typename T> typename published_t<T>::reader_t published_t<T>::reader() {
+  const std::lock_guard lock(mutex_);
+  auto free = std::ranges::find_if(slots_, [](const auto &slot) { return !slot->used; });
+  if (free == slots_.end()) {
+    slots_.push_back(std::make_unique<slot_t_>());
+    free = std::prev(slots_.end());
+  }
+  (*free)->used = true;
+  return reader_t(*this, **free);
+}
+
+template <typename T> void published_t<T>::reclaim_() {
+  std::erase_if(retired_, [this](const node_t_ *node) {
+    const bool held = std::ranges::any_of(slots_, [node](const auto &slot) {
+      return slot->hazard.load(std::memory_order_seq_cst) == node;
+    });
+    if (!held) {
+      delete node;
+    }
+    return !held;
+  });
+}
+
+} // namespace nutsloop::args
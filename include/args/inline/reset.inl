@@ -0,0 +1,26 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::reset() {
+  // containers are cleared rather than replaced, so their buckets and
+  // buffers serve the next parse.
+  keys_.invalidate();
+  arguments_.clear();
+  command_.clear();
+  values_.clear();
+  switches_.clear();
+  is_single_dash_ = false;
+  expect_command_ = true;
+  equal_sign_pos_ = 0;
+  value_ = {};
+  key_ = {};
+  arg_ = {};
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,88 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename Sequencer>
+resolver<Sequencer>::resolver(const Sequencer &sequencer, resolver_options_t options)
+    : sequencer_(sequencer), env_prefix_(std::move(options.env_prefix)),
+      config_path_(std::move(options.config_path)) {
+  if (options.skip_digit_check) {
+    skip_digit_check_.emplace(options.skip_digit_check->begin(), options.skip_digit_check->end());
+  }
+  if (options.typed_keys) {
+    typed_keys_.emplace(options.typed_keys->begin(), options.typed_keys->end());
+  }
+}
+
+template <typename Sequencer>
+const args_key_value_t_ *resolver<Sequencer>::find(const std::string_view key) const {
+  if (const auto *value = from_argv_(key)) {
+    return value;
+  }
+  const auto &resolved = resolve_(key);
+  return resolved.value ? &*resolved.value : nullptr;
+}
+
+template <typename Sequencer>
+template <OptionTypes T>
+std::optional<T> resolver<Sequencer>::get_arg(const std::string_view key) const {
+  const auto *value = find(key);
+  if (value == nullptr) {
+    return std::nullopt;
+  }
+
+  if (const auto *typed = std::get_if<T>(value)) {
+    return *typed;
+  }
+
+  throw std::invalid_argument(std::format("--{} accept only {}", key, option_type_name_t<T>::get()));
+}
+
+template <typename Sequencer>
+resolver_layer_t resolver<Sequencer>::layer_of(const std::string_view key) const {
+  if (from_argv_(key) != nullptr) {
+    return resolver_layer_t::argv;
+  }
+  return resolve_(key).layer;
+}
+
+template <typename Sequencer>
+const args_key_value_t_ *resolver<Sequencer>::from_argv_(const std::string_view key) const {
+  const auto &arguments = sequencer_.get_args();
+  const auto it = arguments.find(key);
+  return it == arguments.end() ? nullptr : &it->second;
+}
+
+template <typename Sequencer>
+bool resolver<Sequencer>::skips_digit_check_(const std::string_view key) const {
+  return skip_digit_check_ ? skip_digit_check_->contains(key)
+                           : sequencer_.skip_digit_check().contains(key);
+}
+
+template <typename Sequencer>
+bool resolver<Sequencer>::infers_types_(const std::string_view key) const {
+  return typed_keys_ ? typed_keys_->contains(key) : sequencer_.typed_keys().contains(key);
+}
+
+template <typename Sequencer>
+const typename resolver<Sequencer>::resolved_t_ &
+resolver<Sequencer>::resolve_(const std::string_view key) const {
+  if (const auto it = memo_.find(key); it != memo_.end()) {
+    return it->second;
+  }
+
+  // registered switches live in the sequencer's switch set, not in get_args().
+  resolved_t_ resolved;
+  if (const auto flag = sequencer_.switches().find(key)) {
+    resolved = {args_key_value_t_(*flag), resolver_layer_t::argv};
+  } else if (auto value = from_environment_(key)) {
+    resolved = {std::move(value), resolver_layer_t::environment};
+  } else if (auto entry = from_config_file_(key)) {
+    resolved = {std::move(entry), resolver_layer_t::config_file};
+  }
+
+  // misses are memoized too, so an absent key never reaches the layers again.
+  return memo_.emplace(std::string(key), std::move(resolved)).first->second;
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,146 @@
+#pragma once
+
+namespace nutsloop::args {
+
+namespace detail {
+
+// Environment variable name for `key`: `<prefix>` + upper-case key, with
+// `-` and `.` mapped to `_` (`max-threads` -> `APP_MAX_THREADS`).
+inline std::string environment_name_(const std::string_view prefix, const std::string_view key) {
+  std::string name;
+  name.reserve(prefix.size() + key.size());
+  name.append(prefix);
+  for (const char c : key) {
+    if (c == '-' || c == '.') {
+      name.push_back('_');
+    } else if (c >= 'a' && c <= 'z') {
+      name.push_back(static_cast<char>(c - 'a' + 'A'));
+    } else {
+      name.push_back(c);
+    }
+  }
+  return name;
+}
+
+inline std::string_view trim_(std::string_view text) {
+  constexpr std::string_view blanks = " \t\r";
+  const auto first = text.find_first_not_of(blanks);
+  if (first == std::string_view::npos) {
+    return {};
+  }
+  text = text.substr(first);
+  return text.substr(0, text.find_last_not_of(blanks) + 1);
+}
+
+} // namespace detail
+
+template <typename Sequencer>
+std::optional<args_key_value_t_>
+resolver<Sequencer>::from_environment_(const std::string_view key) const {
+  if (!env_prefix_) {
+    return std::nullopt;
+  }
+
+  // one getenv per key: the environment is never scanned as a whole.
+  const std::string name = detail::environment_name_(*env_prefix_, key);
+  const char *value = std::getenv(name.c_str());
+  if (value == nullptr) {
+    return std::nullopt;
+  }
+
+  const std::string_view text(value);
+  return interpret_(key, text.empty() ? std::nullopt : std::optional<std::string_view>(text));
+}
+
+template <typename Sequencer>
+std::optional<args_key_value_t_>
+resolver<Sequencer>::from_config_file_(const std::string_view key) const {
+  if (!config_path_) {
+    return std::nullopt;
+  }
+
+  load_config_file_();
+
+  const auto it = config_entries_.find(key);
+  if (it == config_entries_.end()) {
+    return std::nullopt;
+  }
+  return interpret_(key, it->second);
+}
+
+/**
+ * Indexes the config file as views into its mapping.
+ *
+ * One entry per line: `key=value`, or a bare `key` for a switch. Blank lines
+ * and lines starting with `#` or `;` are skipped, whitespace around keys and
+ * values is ignored, a value wrapped in matching quotes loses them, and a
+ * later line for the same key wins, as on the command line.
+ *
+ * @throws std::invalid_argument if the file cannot be opened.
+ */
+template <typename Sequencer> void resolver<Sequencer>::load_config_file_() const {
+  if (config_loaded_) {
+    return;
+  }
+
+  config_file_ = mapped_file_t::open(*config_path_);
+  if (!config_file_) {
+    throw std::invalid_argument(std::format("{}: cannot open config file", *config_path_));
+  }
+  config_loaded_ = true;
+
+  const auto data = config_file_->data();
+  std::string_view text(data.data(), data.size());
+  while (!text.empty()) {
+    const auto end_of_line = text.find('\n');
+    const std::string_view line = detail::trim_(text.substr(0, end_of_line));
+    text = end_of_line == std::string_view::npos ? std::string_view{} : text.substr(end_of_line + 1);
+
+    if (line.empty() || line.front() == '#' || line.front() == ';') {
+      continue;
+    }
+
+    const auto equal_sign_pos = line.find('=');
+    const std::string_view key = detail::trim_(line.substr(0, equal_sign_pos));
+    if (key.empty()) {
+      continue;
+    }
+
+    std::optional<std::string_view> value;
+    if (equal_sign_pos != std::string_view::npos) {
+      std::string_view raw = detail::trim_(line.substr(equal_sign_pos + 1));
+      const bool quoted = raw.size() >= 2 && (raw.front() == '"' || raw.front() == '\'');
+      if (quoted && raw.back() == raw.front()) {
+        raw = raw.substr(1, raw.size() - 2);
+      }
+      if (!raw.empty()) {
+        value = raw;
+      }
+    }
+    config_entries_.insert_or_assign(key, value);
+  }
+}
+
+template <typename Sequencer>
+args_key_value_t_ resolver<Sequencer>::interpret_(const std::string_view key,
+                                                  const std::optional<std::string_view> value) const {
+  if (!value) {
+    return key.find("disable-") == std::string_view::npos;
+  }
+
+  if (skips_digit_check_(key)) {
+    return std::string(*value);
+  }
+
+  return std::visit(
+      [&value]<typename T>(const T &typed) -> args_key_value_t_ {
+        if constexpr (std::same_as<T, std::monostate>) {
+          return std::string(*value);
+        } else {
+          return typed;
+        }
+      },
+      detail::infer_value_(*value, infers_types_(key)));
+}
+
+} // namespace nutsloop::args
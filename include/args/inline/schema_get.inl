@@ -0,0 +1,51 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+template <fixed_string_t Name>
+decltype(auto) schema_sequencer<Options...>::get() const {
+  constexpr std::size_t index = index_of_(Name.view());
+  static_assert(index < option_count_,
+                "schema_sequencer::get: no option with this name in the schema.");
+
+  using option = option_at_<index>;
+  const auto &slot = slots_of_<typename option::value_type>()[slot_of_table_[index]];
+  if constexpr (option::has_default) {
+    return *slot;
+  } else {
+    return slot;
+  }
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+template <fixed_string_t Name, OptionTypes T>
+std::optional<T> schema_sequencer<Options...>::get_arg() const {
+  constexpr std::size_t index = index_of_(Name.view());
+  static_assert(index < option_count_,
+                "schema_sequencer::get_arg: no option with this name in the schema.");
+  static_assert(std::same_as<typename option_at_<index>::value_type, T>,
+                "schema_sequencer::get_arg: T does not match the type declared in the schema.");
+  return slots_of_<T>()[slot_of_table_[index]];
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+template <fixed_string_t Name>
+bool schema_sequencer<Options...>::has() const {
+  constexpr std::size_t index = index_of_(Name.view());
+  static_assert(index < option_count_,
+                "schema_sequencer::has: no option with this name in the schema.");
+  return passed_[index];
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+bool schema_sequencer<Options...>::has(std::string_view key) const {
+  const auto found = key_table_.find(key);
+  return found != perfect_hash_t<key_count_>::npos && passed_[key_options_table_[found]];
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,110 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+void schema_sequencer<Options...>::parse_(const int argc, char *argv[]) {
+
+  int first = 1;
+  if (first < argc) {
+    if (const std::string_view command = argv[first]; !command.starts_with('-')) {
+      command_ = command;
+      ++first;
+    }
+  }
+
+  for (int i = first; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+
+    if (!arg.starts_with('-')) {
+      throw std::invalid_argument(std::format("flags start with `--` or `-`. try --{}", arg));
+    }
+
+    if (arg.ends_with('=')) {
+      throw std::invalid_argument(std::format("{}??? does it require a value? if yes try -> "
+                                              "{}something\nif not, omit the `=` -> {}",
+                                              arg, arg, arg.substr(0, arg.size() - 1)));
+    }
+
+    const std::string_view body = arg.substr(arg.starts_with("--") ? 2 : 1);
+    const auto equal_sign_pos = body.find('=');
+    const std::string_view key = body.substr(0, equal_sign_pos);
+    std::optional<std::string_view> value;
+    if (equal_sign_pos != std::string_view::npos) {
+      value = body.substr(equal_sign_pos + 1);
+    }
+
+    // declared options take precedence over the reserved help/version keys.
+    if (const auto found = key_table_.find(key); found != perfect_hash_t<key_count_>::npos) {
+      store_(key_options_table_[found], key, value);
+      continue;
+    }
+
+    if (const auto request = detail::match_early_exit_(arg, static_cast<std::size_t>(i))) {
+      if (request->kind == early_exit_kind_t::help) {
+        help_ = std::string(request->topic);
+      } else {
+        version_string_ = std::string(version_string_t(version_).view());
+      }
+      break;
+    }
+
+    throw std::invalid_argument(std::format("--{} is not a known option.", key));
+  }
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+void schema_sequencer<Options...>::store_(const std::size_t index, const std::string_view key,
+                                          const std::optional<std::string_view> value) {
+  // runtime option index -> the slot array of its declared type.
+  [&]<std::size_t... T>(std::index_sequence<T...>) {
+    ((type_of_[index] == T ? store_as_<std::tuple_element_t<T, option_types_list_t>>(index, key, value)
+                           : void()),
+     ...);
+  }(std::make_index_sequence<std::tuple_size_v<option_types_list_t>>{});
+  passed_[index] = true;
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+template <OptionTypes T>
+void schema_sequencer<Options...>::store_as_(const std::size_t index, const std::string_view key,
+                                             const std::optional<std::string_view> value) {
+  slots_of_<T>()[slot_of_table_[index]] = convert_<T>(key, names_[index], value);
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+template <OptionTypes T>
+T schema_sequencer<Options...>::convert_(const std::string_view key, const std::string_view name,
+                                         const std::optional<std::string_view> value) {
+  if constexpr (std::same_as<T, bool>) {
+    const bool is_disabling = name.find("disable-") != std::string_view::npos;
+    if (value) {
+      throw std::invalid_argument(
+          std::format("--{} is a simple switch that returns {} and should omit the `=` sign.", key,
+                      is_disabling ? "`false`" : "`true`"));
+    }
+    return !is_disabling;
+  } else {
+    if (!value) {
+      throw std::invalid_argument(
+          std::format("--{} requires a value. try --{}=<{}>", key, key, option_type_name_t<T>::get()));
+    }
+
+    if constexpr (std::same_as<T, std::string>) {
+      return std::string(*value);
+    } else {
+      const auto typed = detail::parse_as_<T>(*value);
+      if (!typed) {
+        throw std::invalid_argument(
+            std::format("--{} accept only {}.", key, option_type_name_t<T>::get()));
+      }
+      return *typed;
+    }
+  }
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,78 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+consteval std::array<std::string_view, schema_sequencer<Options...>::key_count_>
+schema_sequencer<Options...>::keys_() {
+  std::array<std::string_view, key_count_> keys{};
+  std::size_t at = 0;
+  ((keys[at++] = Options::name), ...);
+  ((Options::alias.empty() ? void() : void(keys[at++] = Options::alias)), ...);
+  return keys;
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+consteval std::array<std::size_t, schema_sequencer<Options...>::key_count_>
+schema_sequencer<Options...>::key_options_() {
+  std::array<std::size_t, key_count_> options{};
+  constexpr std::array<bool, option_count_> has_alias{!Options::alias.empty()...};
+  std::size_t at = 0;
+  for (std::size_t index = 0; index < option_count_; ++index) {
+    options[at++] = index;
+  }
+  for (std::size_t index = 0; index < option_count_; ++index) {
+    if (has_alias[index]) {
+      options[at++] = index;
+    }
+  }
+  return options;
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+consteval std::array<std::size_t, schema_sequencer<Options...>::option_count_>
+schema_sequencer<Options...>::slot_of_() {
+  std::array<std::size_t, option_count_> slots{};
+  std::array<std::size_t, std::tuple_size_v<option_types_list_t>> used{};
+  for (std::size_t index = 0; index < option_count_; ++index) {
+    slots[index] = used[type_of_[index]]++;
+  }
+  return slots;
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+consteval std::size_t schema_sequencer<Options...>::index_of_(std::string_view name) {
+  const auto key = key_table_.find(name);
+  return key == perfect_hash_t<key_count_>::npos ? option_count_ : key_options_table_[key];
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+schema_sequencer<Options...>::schema_sequencer(int argc, char *argv[],
+                                               const version_opt_t &version) {
+
+  version_ = version.value_or(version_t{0, 0, 1, 0});
+
+  std::size_t index = 0;
+  (set_default_<Options>(index++), ...);
+
+  parse_(argc, argv);
+}
+
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+template <typename Option>
+void schema_sequencer<Options...>::set_default_(const std::size_t index) {
+  if constexpr (Option::has_default) {
+    slots_of_<typename Option::value_type>()[slot_of_table_[index]] = Option::default_value();
+  }
+}
+
+} // namespace nutsloop::args
+
+#include "args/inline/schema_get.inl"
+#include "args/inline/schema_parse_.inl"
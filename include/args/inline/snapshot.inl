@@ -0,0 +1,76 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+std::vector<std::byte>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::snapshot() const {
+  std::vector<std::string> switch_keys;
+  const auto items = snapshot_items_(switch_keys);
+
+  std::vector<std::byte> blob(detail::write_snapshot_(items, command_, {}));
+  detail::write_snapshot_(items, command_, blob);
+  return blob;
+}
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+std::size_t sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::snapshot(
+    const std::span<std::byte> dest) const {
+  std::vector<std::string> switch_keys;
+  return detail::write_snapshot_(snapshot_items_(switch_keys), command_, dest);
+}
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+std::vector<detail::snapshot_item_t_>
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::snapshot_items_(
+    std::vector<std::string> &switch_keys) const {
+  // registered switches answer get_arg<bool>() for each form that was given;
+  // the snapshot stores those forms as plain bool entries.
+  for (std::size_t bit = 0; bit < switches_.size(); ++bit) {
+    const auto name = switches_.name(bit);
+    for (auto key : {std::string(name), std::format("enable-{}", name),
+                     std::format("disable-{}", name)}) {
+      if (arguments_.find(std::string_view(key)) == arguments_.end() && find_switch_(key)) {
+        switch_keys.push_back(std::move(key));
+      }
+    }
+  }
+
+  std::vector<detail::snapshot_item_t_> items;
+  items.reserve(arguments_.size() + switch_keys.size());
+  for (const auto &[key, value] : arguments_) {
+    items.push_back(std::visit(
+        [key = std::string_view(key)]<typename T>(const T &typed) -> detail::snapshot_item_t_ {
+          constexpr auto type = static_cast<std::uint8_t>(detail::key_value_index_<T>());
+          if constexpr (std::same_as<T, std::string>) {
+            return {key, type, 0, typed};
+          } else if constexpr (std::same_as<T, std::nullptr_t>) {
+            return {key, type, 0, {}};
+          } else {
+            return {key, type, detail::to_payload_(typed), {}};
+          }
+        },
+        value));
+  }
+  for (const auto &key : switch_keys) {
+    items.push_back({key, static_cast<std::uint8_t>(detail::key_value_index_<bool>()),
+                     *find_switch_(key) ? 1U : 0U, {}});
+  }
+
+  std::ranges::sort(items, {}, &detail::snapshot_item_t_::key);
+  return items;
+}
+
+} // namespace nutsloop::args
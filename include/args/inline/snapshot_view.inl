@@ -0,0 +1,197 @@
+#pragma once
+
+namespace nutsloop::args {
+
+namespace detail {
+
+inline std::size_t write_snapshot_(const std::span<const snapshot_item_t_> items,
+                                   const std::string_view command,
+                                   const std::span<std::byte> dest) {
+  const std::size_t entries_offset = sizeof(snapshot_header_t_);
+  std::size_t size = entries_offset + items.size() * sizeof(snapshot_entry_t_);
+  for (const auto &item : items) {
+    size += item.key.size() + item.text.size();
+  }
+  size += command.size();
+
+  if (size > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::invalid_argument(std::format("snapshot of {} bytes exceeds 4 GiB", size));
+  }
+  if (dest.size() < size) {
+    return size;
+  }
+
+  auto *const out = dest.data();
+  std::size_t text = entries_offset + items.size() * sizeof(snapshot_entry_t_);
+  const auto put_text = [out, &text](const std::string_view value) {
+    const auto offset = static_cast<std::uint32_t>(text);
+    if (!value.empty()) {
+      std::memcpy(out + text, value.data(), value.size());
+    }
+    text += value.size();
+    return offset;
+  };
+
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    const auto &item = items[i];
+    snapshot_entry_t_ entry{};
+    entry.key_offset = put_text(item.key);
+    entry.key_size = static_cast<std::uint32_t>(item.key.size());
+    entry.type = item.type;
+    if (item.type == key_value_index_<std::string>()) {
+      entry.payload = put_text(item.text);
+      entry.value_size = static_cast<std::uint32_t>(item.text.size());
+    } else {
+      entry.payload = item.payload;
+    }
+    std::memcpy(out + entries_offset + i * sizeof(snapshot_entry_t_), &entry, sizeof(entry));
+  }
+
+  snapshot_header_t_ header{};
+  header.magic = snapshot_magic_;
+  header.format = snapshot_format_version;
+  header.byte_order = snapshot_byte_order_;
+  header.size = size;
+  header.entry_count = static_cast<std::uint32_t>(items.size());
+  header.command_offset = put_text(command);
+  header.command_size = static_cast<std::uint32_t>(command.size());
+  std::memcpy(out, &header, sizeof(header));
+
+  return size;
+}
+
+} // namespace detail
+
+inline snapshot_view_t::snapshot_view_t(const std::span<const std::byte> blob) : blob_(blob) {
+  using detail::snapshot_entry_t_;
+  using detail::snapshot_header_t_;
+
+  if (blob_.size() < sizeof(snapshot_header_t_)) {
+    throw std::invalid_argument("snapshot is shorter than its header");
+  }
+  snapshot_header_t_ header{};
+  std::memcpy(&header, blob_.data(), sizeof(header));
+  if (header.magic != detail::snapshot_magic_) {
+    throw std::invalid_argument("not an args snapshot");
+  }
+  if (header.byte_order != detail::snapshot_byte_order_) {
+    throw std::invalid_argument("snapshot was written with another byte order");
+  }
+  if (header.format != snapshot_format_version) {
+    throw std::invalid_argument(std::format("snapshot format {} is not supported, expected {}",
+                                            header.format, snapshot_format_version));
+  }
+  if (header.size > blob_.size()) {
+    throw std::invalid_argument(
+        std::format("snapshot of {} bytes is truncated to {}", header.size, blob_.size()));
+  }
+  blob_ = blob_.first(static_cast<std::size_t>(header.size));
+
+  const auto entries_end =
+      sizeof(snapshot_header_t_) + std::uint64_t{header.entry_count} * sizeof(snapshot_entry_t_);
+  if (entries_end > blob_.size()) {
+    throw std::invalid_argument("snapshot entries run past its end");
+  }
+  entry_count_ = header.entry_count;
+
+  // written so that neither side can wrap around for hostile offsets.
+  const auto checked_text = [this](const std::uint64_t offset, const std::uint64_t size) {
+    if (offset > blob_.size() || size > blob_.size() - offset) {
+      throw std::invalid_argument("snapshot text runs past its end");
+    }
+    return text_(offset, size);
+  };
+
+  command_ = checked_text(header.command_offset, header.command_size);
+  std::string_view previous;
+  for (std::size_t i = 0; i < entry_count_; ++i) {
+    const auto entry = entry_(i);
+    const auto key = checked_text(entry.key_offset, entry.key_size);
+    if (i != 0 && key <= previous) {
+      throw std::invalid_argument("snapshot keys are not sorted");
+    }
+    previous = key;
+    if (entry.type >= std::variant_size_v<args_key_value_t_>) {
+      throw std::invalid_argument(std::format("--{} has an unknown value type", key));
+    }
+    if (entry.type == detail::key_value_index_<std::string>()) {
+      // the writer only emits 32-bit offsets.
+      if (entry.payload > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument(std::format("--{} has a string offset past 4 GiB", key));
+      }
+      (void)checked_text(entry.payload, entry.value_size);
+    }
+  }
+}
+
+inline std::string_view snapshot_view_t::key(const std::size_t index) const {
+  const auto entry = entry_(index);
+  return text_(entry.key_offset, entry.key_size);
+}
+
+template <OptionTypes T>
+std::optional<T> snapshot_view_t::get_arg(const std::string_view key) const {
+  const auto entry = find_(key);
+  if (!entry) {
+    return std::nullopt;
+  }
+  if (entry->type != detail::key_value_index_<T>()) {
+    throw std::invalid_argument(
+        std::format("--{} accept only {}", key, option_type_name_t<T>::get()));
+  }
+  if constexpr (std::same_as<T, std::string>) {
+    return std::string(text_(entry->payload, entry->value_size));
+  } else {
+    return detail::from_payload_<T>(entry->payload);
+  }
+}
+
+inline std::optional<std::string_view>
+snapshot_view_t::get_view(const std::string_view key) const {
+  const auto entry = find_(key);
+  if (!entry) {
+    return std::nullopt;
+  }
+  if (entry->type != detail::key_value_index_<std::string>()) {
+    throw std::invalid_argument(
+        std::format("--{} accept only {}", key, option_type_name_t<std::string>::get()));
+  }
+  return text_(entry->payload, entry->value_size);
+}
+
+inline detail::snapshot_entry_t_ snapshot_view_t::entry_(const std::size_t index) const {
+  // entries are copied out: a blob carries no alignment guarantee.
+  detail::snapshot_entry_t_ entry{};
+  std::memcpy(&entry,
+              blob_.data() + sizeof(detail::snapshot_header_t_) +
+                  index * sizeof(detail::snapshot_entry_t_),
+              sizeof(entry));
+  return entry;
+}
+
+inline std::string_view snapshot_view_t::text_(const std::uint64_t offset,
+                                               const std::uint64_t size) const {
+  return {reinterpret_cast<const char *>(blob_.data()) + offset, static_cast<std::size_t>(size)};
+}
+
+inline std::optional<detail::snapshot_entry_t_>
+snapshot_view_t::find_(const std::string_view key) const {
+  std::size_t first = 0;
+  std::size_t last = entry_count_;
+  while (first < last) {
+    const auto middle = first + (last - first) / 2;
+    const auto entry = entry_(middle);
+    const auto found = text_(entry.key_offset, entry.key_size);
+    if (found == key) {
+      return entry;
+    }
+    if (found < key) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace nutsloop::args
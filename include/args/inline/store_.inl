@@ -0,0 +1,32 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+template <typename T>
+void
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::store_(const T value) {
+  [[maybe_unused]] const auto timer = recorder_.time(parse_phase_t::store);
+
+  // every occurrence is kept for get_all(); `arguments_` keeps the last one.
+  if constexpr (std::same_as<T, std::string_view>) {
+    values_.push(key_, value);
+  } else if constexpr (std::same_as<T, bool>) {
+    values_.push(key_, value, value ? std::string_view("true") : std::string_view("false"));
+  } else {
+    values_.push(key_, value, value_);
+  }
+
+  if constexpr (std::same_as<T, std::string_view>) {
+    arguments_[std::string(key_)] = std::string(value);
+  } else {
+    arguments_[std::string(key_)] = value;
+  }
+  recorder_.stored(arguments_);
+}
+
+} // namespace nutsloop::args
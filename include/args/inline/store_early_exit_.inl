@@ -0,0 +1,21 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::store_early_exit_(
+    const early_exit_t &request) {
+  [[maybe_unused]] const auto timer = recorder_.time(parse_phase_t::store);
+  if (request.kind == early_exit_kind_t::help) {
+    arguments_["help"] = std::string(request.topic);
+  } else {
+    arguments_["version"] = std::string(version_string_.view());
+  }
+  recorder_.stored(arguments_);
+}
+
+} // namespace nutsloop::args
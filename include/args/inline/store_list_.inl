@@ -0,0 +1,49 @@
+#pragma once
+
+namespace nutsloop::args {
+
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+void sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::store_list_() {
+  recorder_.count(detail::arg_kind_t::list_value);
+
+  // the unsplit value stays available through get_arg<std::string>().
+  {
+    [[maybe_unused]] const auto timer = recorder_.time(parse_phase_t::store);
+    arguments_[std::string(key_)] = std::string(value_);
+    recorder_.stored(arguments_);
+  }
+
+  const std::string_view list = value_;
+  std::size_t begin = 0;
+  while (true) {
+    const std::size_t comma = list.find(',', begin);
+    value_ = list.substr(begin, comma == std::string_view::npos ? comma : comma - begin);
+
+    // each element gets the same type inference as a plain value.
+    const auto typed_value = [this] {
+      [[maybe_unused]] const auto timer = recorder_.time(parse_phase_t::infer);
+      return infer_value_();
+    }();
+    [[maybe_unused]] const auto timer = recorder_.time(parse_phase_t::store);
+    std::visit(
+        [this]<typename T>(const T &typed) {
+          if constexpr (std::same_as<T, std::monostate>) {
+            values_.push(key_, value_);
+          } else {
+            values_.push(key_, typed, value_);
+          }
+        },
+        typed_value);
+
+    if (comma == std::string_view::npos) {
+      break;
+    }
+    begin = comma + 1;
+  }
+}
+
+} // namespace nutsloop::args
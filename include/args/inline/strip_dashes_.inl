@@ -2,9 +2,13 @@
 
 namespace nutsloop::args {
 
-template <typename CheckerClass, typename HelperClass>
-  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>)
-std::string sequencer<CheckerClass, HelperClass>::strip_dashes_() const {
+template <typename CheckerClass, typename HelperClass, typename ParsePolicy, typename Storage,
+          typename Instrumentation>
+  requires ArgsChecker<CheckerClass> && (std::same_as<HelperClass, bool> || ArgsHelper<HelperClass>) &&
+           ArgsParsePolicy<ParsePolicy> && ArgsStorage<Storage> &&
+           ArgsInstrumentation<Instrumentation>
+std::string_view
+sequencer<CheckerClass, HelperClass, ParsePolicy, Storage, Instrumentation>::strip_dashes_() const {
   if (is_single_dash_) {
     return arg_.substr(1, equal_sign_pos_ - 1);
   }
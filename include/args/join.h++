@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
+
+#if __has_include(<sys/uio.h>) && __has_include(<unistd.h>) && __has_include(<limits.h>)
+#define NUTSLOOP_ARGS_HAS_WRITEV 1
+#include <cerrno>
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+#else
+#define NUTSLOOP_ARGS_HAS_WRITEV 0
+#include <cstdio>
+#endif
+
+namespace nutsloop::args {
+
+/**
+ * Length of `parts` joined with a one-character separator, skipping nullptr
+ * entries. The join functions measure with this first so the result is
+ * written in one pass into a buffer of the right size.
+ */
+inline std::size_t joined_size(const std::span<char *const> parts) noexcept {
+  std::size_t size = 0;
+  std::size_t count = 0;
+  for (const char *part : parts) {
+    if (part != nullptr) {
+      size += std::strlen(part);
+      ++count;
+    }
+  }
+  return count == 0 ? 0 : size + count - 1;
+}
+
+namespace detail {
+
+// Writes `parts` joined by `sep` from `out` on; `out` must have room for
+// joined_size(parts) characters.
+inline void copy_joined_(const std::span<char *const> parts, char *out, const char sep) noexcept {
+  bool first = true;
+  for (const char *part : parts) {
+    if (part == nullptr) {
+      continue;
+    }
+    if (!first) {
+      *out++ = sep;
+    }
+    first = false;
+    const std::size_t length = std::strlen(part);
+    std::memcpy(out, part, length);
+    out += length;
+  }
+}
+
+// Replaces the contents of `dest` with `parts` joined by `sep`, growing it at
+// most once and without filling it first where the library allows.
+inline void assign_joined_(const std::span<char *const> parts, std::string &dest, const char sep) {
+  const std::size_t size = joined_size(parts);
+#if defined(__cpp_lib_string_resize_and_overwrite)
+  // returns `size` rather than the count passed in, which some libstdc++
+  // releases set to the capacity.
+  dest.resize_and_overwrite(size, [parts, sep, size](char *out, std::size_t) noexcept {
+    copy_joined_(parts, out, sep);
+    return size;
+  });
+#else
+  dest.resize(size);
+  copy_joined_(parts, dest.data(), sep);
+#endif
+}
+
+} // namespace detail
+
+/**
+ * Joins `parts` with `sep` into `dest`, skipping nullptr entries.
+ *
+ * Returns the joined length. Nothing is written when `dest` is shorter than
+ * that, so a caller can retry with a larger buffer; no terminator is added.
+ */
+inline std::size_t join(const std::span<char *const> parts, const std::span<char> dest,
+                        const char sep = '\n') noexcept {
+  const std::size_t size = joined_size(parts);
+  if (size <= dest.size()) {
+    detail::copy_joined_(parts, dest.data(), sep);
+  }
+  return size;
+}
+
+/**
+ * Fills `dest` with `buf_size` entries of `buf` joined by `sep`, skipping
+ * nullptr entries. `dest` is resized once to the joined length, so reusing
+ * the same string across calls allocates only when it has to grow.
+ */
+inline void join(char *buf[], const std::size_t buf_size, std::string &dest,
+                 const char sep = '\n') {
+  if (buf_size == 0) {
+    dest.clear();
+    return;
+  }
+
+  detail::assign_joined_(std::span<char *const>(buf, buf_size), dest, sep);
+}
+
+/**
+ * Writes `parts` joined by `sep` to the file descriptor `fd`, skipping
+ * nullptr entries, without building the joined string.
+ *
+ * On POSIX the arguments and separators are handed to writev() in batches of
+ * at most IOV_MAX buffers; partial writes and EINTR are retried. Elsewhere
+ * only stdout (1) and stderr (2) are supported, through std::fwrite().
+ *
+ * Returns false when a write fails; errno is left as set by the failing call.
+ */
+inline bool write_joined(const int fd, const std::span<char *const> parts, const char sep = '\n') {
+#if NUTSLOOP_ARGS_HAS_WRITEV
+  constexpr std::size_t batch_size = IOV_MAX < 1024 ? IOV_MAX : 1024;
+  iovec batch[batch_size];
+  char separator = sep;
+
+  const auto flush = [fd](iovec *first, std::size_t count) {
+    while (count > 0) {
+      const ssize_t written = ::writev(fd, first, static_cast<int>(count));
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      // drop the buffers written in full, then trim the one cut short.
+      auto remaining = static_cast<std::size_t>(written);
+      while (count > 0 && remaining >= first->iov_len) {
+        remaining -= first->iov_len;
+        ++first;
+        --count;
+      }
+      if (count > 0) {
+        first->iov_base = static_cast<char *>(first->iov_base) + remaining;
+        first->iov_len -= remaining;
+      }
+    }
+    return true;
+  };
+
+  std::size_t used = 0;
+  bool first = true;
+  for (char *part : parts) {
+    if (part == nullptr) {
+      continue;
+    }
+    // a part and its separator always go out in the same batch.
+    if (used + 2 > batch_size) {
+      if (!flush(batch, used)) {
+        return false;
+      }
+      used = 0;
+    }
+    if (!first) {
+      batch[used++] = {&separator, 1};
+    }
+    first = false;
+    batch[used++] = {part, std::strlen(part)};
+  }
+  return flush(batch, used);
+#else
+  std::FILE *stream = fd == 1 ? stdout : fd == 2 ? stderr : nullptr;
+  if (stream == nullptr) {
+    return false;
+  }
+  bool first = true;
+  for (const char *part : parts) {
+    if (part == nullptr) {
+      continue;
+    }
+    if (!first && std::fputc(sep, stream) == EOF) {
+      return false;
+    }
+    first = false;
+    const std::size_t length = std::strlen(part);
+    if (std::fwrite(part, 1, length, stream) != length) {
+      return false;
+    }
+  }
+  return std::fflush(stream) == 0;
+#endif
+}
+
+} // namespace nutsloop::args
@@ -1,7 +1,12 @@
 #pragma once
 
+#include "args/types/args_duration_t.h++"
+#include "args/types/args_size_t.h++"
+
+#include <cstddef>     // For std::size_t
 #include <string>      // For std::string
 #include <string_view> // For std::string_view
+#include <tuple>       // For std::tuple
 #include <type_traits> // For std::is_same, std::disjunction_v, std::is_same_v
 
 namespace nutsloop {
@@ -10,7 +15,26 @@ namespace nutsloop {
 template <typename T>
 concept OptionTypes =
     std::disjunction_v<std::is_same<T, std::string>, // Note: std::is_same, not std::is_same_v here
-                       std::is_same<T, unsigned long long>, std::is_same<T, bool>>;
+                       std::is_same<T, unsigned long long>, std::is_same<T, bool>,
+                       std::is_same<T, long long>, std::is_same<T, double>,
+                       std::is_same<T, args::args_duration_t>, std::is_same<T, args::args_size_t>>;
+
+// Every type allowed by OptionTypes, in a fixed order usable as a type index
+using option_types_list_t = std::tuple<std::string, unsigned long long, bool, long long, double,
+                                       args::args_duration_t, args::args_size_t>;
+
+// Position of T in option_types_list_t
+template <typename T, typename List = option_types_list_t> struct option_type_index_t;
+
+template <typename T, typename... Ts> struct option_type_index_t<T, std::tuple<T, Ts...>> {
+  static constexpr std::size_t value = 0;
+};
+
+template <typename T, typename U, typename... Ts> struct option_type_index_t<T, std::tuple<U, Ts...>> {
+  static constexpr std::size_t value = 1 + option_type_index_t<T, std::tuple<Ts...>>::value;
+};
+
+template <typename T> inline constexpr std::size_t option_type_index_v = option_type_index_t<T>::value;
 
 // Struct to get the type name string
 template <typename T>
@@ -27,6 +51,14 @@ struct option_type_name_t {
         return "unsigned long long";
       } else if constexpr (std::is_same_v<T, bool>) {
         return "bool";
+      } else if constexpr (std::is_same_v<T, long long>) {
+        return "long long";
+      } else if constexpr (std::is_same_v<T, double>) {
+        return "double";
+      } else if constexpr (std::is_same_v<T, args::args_duration_t>) {
+        return "duration";
+      } else if constexpr (std::is_same_v<T, args::args_size_t>) {
+        return "size";
       } else {
         // This 'else' branch should ideally not be reached if OptionTypes<T> is true
         // and all types covered by the OptionTypes concept are handled above.
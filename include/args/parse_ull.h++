@@ -0,0 +1,93 @@
+#pragma once
+
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+namespace nutsloop::args::detail {
+
+// Longest decimal form of an unsigned long long; longer values are never
+// numbers, even when zero-padded.
+inline constexpr std::size_t ull_max_digits_ = std::numeric_limits<unsigned long long>::digits10 + 1;
+
+// True when all eight bytes of `chunk` are ASCII digits: the high nibble of
+// every byte must be 3 and adding 6 must not carry into it.
+constexpr bool swar_eight_digits_(const std::uint64_t chunk) noexcept {
+  return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// Value of eight ASCII digits loaded little-endian, folded pairwise with
+// three multiplications instead of eight.
+constexpr std::uint32_t swar_eight_digits_value_(std::uint64_t chunk) noexcept {
+  chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+  chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+  return static_cast<std::uint32_t>(((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+}
+
+/**
+ * Validates and converts `value` in a single pass.
+ *
+ * Returns the number when `value` is one to twenty ASCII digits that fit in an
+ * unsigned long long, std::nullopt otherwise. On little-endian targets eight
+ * digits are classified and converted per step with SWAR arithmetic; the last
+ * digit of a twenty-digit value is checked for overflow. Other targets use
+ * std::from_chars.
+ */
+inline std::optional<unsigned long long> parse_ull_(const std::string_view value) noexcept {
+  if (value.empty() || value.size() > ull_max_digits_) {
+    return std::nullopt;
+  }
+
+  if constexpr (std::endian::native != std::endian::little) {
+    unsigned long long number = 0;
+    const auto *end = value.data() + value.size();
+    const auto [ptr, ec] = std::from_chars(value.data(), end, number);
+    if (ec != std::errc{} || ptr != end) {
+      return std::nullopt;
+    }
+    return number;
+  } else {
+    const char *cursor = value.data();
+    // up to 19 digits always fit; only the twentieth can overflow.
+    const std::size_t safe = value.size() < ull_max_digits_ ? value.size() : ull_max_digits_ - 1;
+    const char *safe_end = cursor + safe;
+
+    unsigned long long number = 0;
+    for (; safe_end - cursor >= 8; cursor += 8) {
+      std::uint64_t chunk = 0;
+      std::memcpy(&chunk, cursor, sizeof(chunk));
+      if (!swar_eight_digits_(chunk)) {
+        return std::nullopt;
+      }
+      number = number * 100000000ULL + swar_eight_digits_value_(chunk);
+    }
+
+    for (; cursor != safe_end; ++cursor) {
+      const auto digit = static_cast<unsigned char>(*cursor - '0');
+      if (digit > 9) {
+        return std::nullopt;
+      }
+      number = number * 10 + digit;
+    }
+
+    if (safe == value.size()) {
+      return number;
+    }
+
+    const auto digit = static_cast<unsigned char>(*cursor - '0');
+    constexpr auto max = std::numeric_limits<unsigned long long>::max();
+    if (digit > 9 || number > (max - digit) / 10) {
+      return std::nullopt;
+    }
+    return number * 10 + digit;
+  }
+}
+
+} // namespace nutsloop::args::detail
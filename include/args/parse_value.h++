@@ -0,0 +1,217 @@
+#pragma once
+
+#include "args/parse_ull.h++"
+#include "args/types/args_duration_t.h++"
+#include "args/types/args_size_t.h++"
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <variant>
+
+namespace nutsloop::args::detail {
+
+// `-` followed by digits that fit in a long long.
+inline std::optional<long long> parse_ll_(const std::string_view value) noexcept {
+  if (value.size() < 2 || value.front() != '-') {
+    return std::nullopt;
+  }
+  long long number = 0;
+  const auto *end = value.data() + value.size();
+  const auto [ptr, ec] = std::from_chars(value.data(), end, number);
+  if (ec != std::errc{} || ptr != end) {
+    return std::nullopt;
+  }
+  return number;
+}
+
+// Decimal floating-point forms (`1.5`, `-0.25`, `.5`, `1e-3`). Words
+// std::from_chars also accepts, like `inf` or `nan`, are not numbers here.
+inline std::optional<double> parse_double_(const std::string_view value) noexcept {
+  const std::string_view digits = value.starts_with('-') ? value.substr(1) : value;
+  if (digits.empty() ||
+      !(digits.front() == '.' || (digits.front() >= '0' && digits.front() <= '9'))) {
+    return std::nullopt;
+  }
+  double number = 0;
+  const auto *end = value.data() + value.size();
+  const auto [ptr, ec] = std::from_chars(value.data(), end, number, std::chars_format::general);
+  if (ec != std::errc{} || ptr != end) {
+    return std::nullopt;
+  }
+  return number;
+}
+
+// Splits `value` into its leading digits and the unit suffix after them.
+constexpr std::pair<std::string_view, std::string_view>
+split_unit_(const std::string_view value) noexcept {
+  std::size_t digits = 0;
+  while (digits < value.size() && value[digits] >= '0' && value[digits] <= '9') {
+    ++digits;
+  }
+  return {value.substr(0, digits), value.substr(digits)};
+}
+
+// `count * scale`, or std::nullopt when it does not fit in `limit`.
+constexpr std::optional<unsigned long long> scale_(const std::string_view digits,
+                                                   const unsigned long long scale,
+                                                   const unsigned long long limit) noexcept {
+  if (digits.empty() || digits.size() > ull_max_digits_) {
+    return std::nullopt;
+  }
+  unsigned long long count = 0;
+  for (const char c : digits) {
+    const auto digit = static_cast<unsigned long long>(c - '0');
+    if (count > (limit - digit) / 10) {
+      return std::nullopt;
+    }
+    count = count * 10 + digit;
+  }
+  if (count > limit / scale) {
+    return std::nullopt;
+  }
+  return count * scale;
+}
+
+// Digits followed by one of ns, us, ms, s, m, h, d.
+constexpr std::optional<args_duration_t> parse_duration_(const std::string_view value) noexcept {
+  constexpr std::array<std::pair<std::string_view, unsigned long long>, 7> units{{
+      {"ns", 1ULL},
+      {"us", 1000ULL},
+      {"ms", 1000000ULL},
+      {"s", 1000000000ULL},
+      {"m", 60ULL * 1000000000ULL},
+      {"h", 3600ULL * 1000000000ULL},
+      {"d", 86400ULL * 1000000000ULL},
+  }};
+
+  const auto [digits, unit] = split_unit_(value);
+  for (const auto &[name, scale] : units) {
+    if (unit == name) {
+      constexpr auto limit =
+          static_cast<unsigned long long>(std::numeric_limits<args_duration_t::rep>::max());
+      if (const auto count = scale_(digits, scale, limit)) {
+        return args_duration_t(static_cast<args_duration_t::rep>(*count));
+      }
+      return std::nullopt;
+    }
+  }
+  return std::nullopt;
+}
+
+// Digits followed by B, K/KiB, KB, M/MiB, MB, G/GiB, GB, T/TiB or TB. A bare
+// letter and the `iB` forms are powers of 1024, the `B` forms powers of 1000.
+// With `bare_bytes`, digits without a unit are accepted as bytes.
+constexpr std::optional<args_size_t> parse_size_(const std::string_view value,
+                                                 const bool bare_bytes = false) noexcept {
+  constexpr unsigned long long Ki = 1024ULL;
+  constexpr std::array<std::pair<std::string_view, unsigned long long>, 13> units{{
+      {"B", 1ULL},
+      {"K", Ki},
+      {"KiB", Ki},
+      {"KB", 1000ULL},
+      {"M", Ki * Ki},
+      {"MiB", Ki * Ki},
+      {"MB", 1000000ULL},
+      {"G", Ki * Ki * Ki},
+      {"GiB", Ki * Ki * Ki},
+      {"GB", 1000000000ULL},
+      {"T", Ki * Ki * Ki * Ki},
+      {"TiB", Ki * Ki * Ki * Ki},
+      {"TB", 1000000000000ULL},
+  }};
+
+  const auto [digits, unit] = split_unit_(value);
+  if (unit.empty() && !bare_bytes) {
+    return std::nullopt;
+  }
+  for (const auto &[name, scale] : units) {
+    if (unit == name || (unit.empty() && scale == 1)) {
+      constexpr auto limit = std::numeric_limits<unsigned long long>::max();
+      if (const auto bytes = scale_(digits, scale, limit)) {
+        return args_size_t{*bytes};
+      }
+      return std::nullopt;
+    }
+  }
+  return std::nullopt;
+}
+
+/**
+ * Converts `value` to a declared type T, for callers that know the type up
+ * front (schema_sequencer). Unlike inference, a long long may be written
+ * without a sign, a double as a plain integer and a size as bare bytes.
+ * Returns std::nullopt when `value` is not a T or does not fit in one.
+ */
+template <typename T> std::optional<T> parse_as_(const std::string_view value) noexcept {
+  if constexpr (std::same_as<T, unsigned long long>) {
+    return parse_ull_(value);
+  } else if constexpr (std::same_as<T, long long>) {
+    long long number = 0;
+    const auto *end = value.data() + value.size();
+    const auto [ptr, ec] = std::from_chars(value.data(), end, number);
+    if (value.empty() || ec != std::errc{} || ptr != end) {
+      return std::nullopt;
+    }
+    return number;
+  } else if constexpr (std::same_as<T, double>) {
+    return parse_double_(value);
+  } else if constexpr (std::same_as<T, args_duration_t>) {
+    return parse_duration_(value);
+  } else {
+    static_assert(std::same_as<T, args_size_t>, "parse_as_: unsupported type.");
+    return parse_size_(value, true);
+  }
+}
+
+// Result of inferring the type of an untyped value; std::monostate keeps it a string.
+using inferred_value_t = std::variant<std::monostate, unsigned long long, long long, double,
+                                      args_duration_t, args_size_t>;
+
+/**
+ * Infers the type of a command-line value. Digits are always an unsigned
+ * long long; only when `typed` is set are the other forms tried, in this
+ * order: `-digits` a long long, a number with a fraction or an exponent a
+ * double, digits with a duration unit a duration and digits with a size unit
+ * a size. Anything else, including numbers that overflow their type, stays a
+ * string. Duration units are lower case and size units upper case, so the
+ * forms never overlap.
+ */
+inline inferred_value_t infer_value_(const std::string_view value, const bool typed) noexcept {
+  if (value.empty()) {
+    return {};
+  }
+  if (const auto number = parse_ull_(value)) {
+    return *number;
+  }
+  // every other form starts with a digit, '-' or '.'.
+  const char first = value.front();
+  if (!typed || !(first == '-' || first == '.' || (first >= '0' && first <= '9'))) {
+    return {};
+  }
+  if (const auto number = parse_ll_(value)) {
+    return *number;
+  }
+  // integers that overflow stay strings rather than turning into doubles.
+  if (value.find_first_of(".eE") != std::string_view::npos) {
+    if (const auto number = parse_double_(value)) {
+      return *number;
+    }
+  }
+  if (const auto duration = parse_duration_(value)) {
+    return *duration;
+  }
+  if (const auto size = parse_size_(value)) {
+    return *size;
+  }
+  return {};
+}
+
+} // namespace nutsloop::args::detail
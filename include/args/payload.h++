@@ -0,0 +1,40 @@
+#pragma once
+
+#include "args/types/args_duration_t.h++"
+#include "args/types/args_size_t.h++"
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+
+namespace nutsloop::args::detail {
+
+// Non-string option values travel through 64-bit payloads in the columnar
+// stores (args_values_t, batch_result_t) and are rebuilt on the way out.
+template <typename T> constexpr std::uint64_t to_payload_(const T value) noexcept {
+  if constexpr (std::same_as<T, double>) {
+    return std::bit_cast<std::uint64_t>(value);
+  } else if constexpr (std::same_as<T, args_duration_t>) {
+    return static_cast<std::uint64_t>(value.count());
+  } else if constexpr (std::same_as<T, args_size_t>) {
+    return value.bytes;
+  } else {
+    return static_cast<std::uint64_t>(value);
+  }
+}
+
+template <typename T> constexpr T from_payload_(const std::uint64_t payload) noexcept {
+  if constexpr (std::same_as<T, double>) {
+    return std::bit_cast<double>(payload);
+  } else if constexpr (std::same_as<T, args_duration_t>) {
+    return args_duration_t(static_cast<args_duration_t::rep>(payload));
+  } else if constexpr (std::same_as<T, args_size_t>) {
+    return args_size_t{payload};
+  } else if constexpr (std::same_as<T, bool>) {
+    return payload != 0;
+  } else {
+    return static_cast<T>(payload);
+  }
+}
+
+} // namespace nutsloop::args::detail
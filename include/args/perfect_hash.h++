@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace nutsloop::args {
+
+// Seeded FNV-1a with a final avalanche step. Usable at compile time and at
+// runtime so both sides agree on where a key lands.
+constexpr std::uint64_t perfect_hash_mix_(std::string_view key, std::uint64_t seed) noexcept {
+  std::uint64_t hash = 14695981039346656037ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+  for (const char c : key) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// Minimal-collision perfect hash over N keys using hash-and-displace:
+// keys are first spread into buckets, then every bucket, largest first,
+// searches for a displacement seed that drops all of its keys into free
+// slots. A lookup costs two hashes and one string compare.
+template <std::size_t N> struct perfect_hash_t {
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+  static constexpr std::size_t bucket_count = N / 2 + 1;
+  static constexpr std::size_t slot_count = std::bit_ceil(N * 2 + 1);
+  static constexpr std::uint16_t empty_slot = 0xFFFF;
+
+  static_assert(N < empty_slot, "perfect_hash_t: too many keys.");
+
+  std::array<std::string_view, N> keys{};
+  std::array<std::uint32_t, bucket_count> displacement{};
+  std::array<std::uint16_t, slot_count> slots{};
+
+  // Returns the position of `key` in `keys`, or npos when it is not a key.
+  [[nodiscard]] constexpr std::size_t find(std::string_view key) const noexcept {
+    if constexpr (N == 0) {
+      return npos;
+    } else {
+      const auto bucket = perfect_hash_mix_(key, 0) % bucket_count;
+      const auto slot = perfect_hash_mix_(key, displacement[bucket]) & (slot_count - 1);
+      const auto index = slots[slot];
+      if (index == empty_slot || keys[index] != key) {
+        return npos;
+      }
+      return index;
+    }
+  }
+};
+
+// Builds the table at compile time. Duplicate keys make the build fail.
+template <std::size_t N>
+consteval perfect_hash_t<N> make_perfect_hash(const std::array<std::string_view, N> &keys) {
+  using table_t = perfect_hash_t<N>;
+  table_t table{};
+  table.keys = keys;
+  table.slots.fill(table_t::empty_slot);
+
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t j = i + 1; j < N; ++j) {
+      if (keys[i] == keys[j]) {
+        throw "make_perfect_hash: duplicate key";
+      }
+    }
+  }
+
+  std::array<std::size_t, N> bucket_of{};
+  std::array<std::size_t, table_t::bucket_count> bucket_size{};
+  for (std::size_t i = 0; i < N; ++i) {
+    bucket_of[i] = perfect_hash_mix_(keys[i], 0) % table_t::bucket_count;
+    ++bucket_size[bucket_of[i]];
+  }
+
+  std::array<bool, table_t::bucket_count> placed{};
+  for (std::size_t round = 0; round < table_t::bucket_count; ++round) {
+    // pick the largest bucket still waiting for a displacement.
+    std::size_t bucket = 0;
+    std::size_t largest = 0;
+    bool found = false;
+    for (std::size_t b = 0; b < table_t::bucket_count; ++b) {
+      if (!placed[b] && (!found || bucket_size[b] > largest)) {
+        bucket = b;
+        largest = bucket_size[b];
+        found = true;
+      }
+    }
+    placed[bucket] = true;
+    if (largest == 0) {
+      continue;
+    }
+
+    for (std::uint32_t seed = 1;; ++seed) {
+      std::array<std::size_t, N> candidate{};
+      std::size_t count = 0;
+      bool collides = false;
+      for (std::size_t i = 0; i < N && !collides; ++i) {
+        if (bucket_of[i] != bucket) {
+          continue;
+        }
+        const auto slot = perfect_hash_mix_(keys[i], seed) & (table_t::slot_count - 1);
+        collides = table.slots[slot] != table_t::empty_slot;
+        for (std::size_t k = 0; k < count && !collides; ++k) {
+          collides = candidate[k] == slot;
+        }
+        candidate[count++] = slot;
+      }
+      if (collides) {
+        continue;
+      }
+
+      table.displacement[bucket] = seed;
+      for (std::size_t i = 0, k = 0; i < N; ++i) {
+        if (bucket_of[i] == bucket) {
+          table.slots[candidate[k++]] = static_cast<std::uint16_t>(i);
+        }
+      }
+      break;
+    }
+  }
+
+  return table;
+}
+
+} // namespace nutsloop::args
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace nutsloop::args::detail {
+
+/**
+ * Growable array of trivially copyable elements drawn from a
+ * std::pmr::memory_resource.
+ *
+ * std::pmr::vector constructs, copies and relocates its elements one at a
+ * time through polymorphic_allocator::construct, which is many times slower
+ * than memcpy for the byte arenas and fixed-size records args_values_t keeps.
+ * This buffer moves whole blocks instead and follows std::pmr::vector for
+ * which resource a copy or move ends up using.
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>
+class pmr_buffer_t {
+public:
+  using value_type = T;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  pmr_buffer_t() noexcept : pmr_buffer_t(std::pmr::get_default_resource()) {}
+
+  explicit pmr_buffer_t(std::pmr::memory_resource *resource) noexcept : resource_(resource) {}
+
+  // like std::pmr::vector, a copy draws from the default resource.
+  pmr_buffer_t(const pmr_buffer_t &other) : pmr_buffer_t() { append(other.data(), other.size()); }
+
+  pmr_buffer_t(pmr_buffer_t &&other) noexcept
+      : resource_(other.resource_), data_(std::exchange(other.data_, nullptr)),
+        size_(std::exchange(other.size_, 0)), capacity_(std::exchange(other.capacity_, 0)) {}
+
+  pmr_buffer_t &operator=(const pmr_buffer_t &other) {
+    if (this != &other) {
+      clear();
+      append(other.data(), other.size());
+    }
+    return *this;
+  }
+
+  // the storage is taken over only when both sides share a resource.
+  pmr_buffer_t &operator=(pmr_buffer_t &&other) {
+    if (this == &other) {
+      return *this;
+    }
+    if (resource_->is_equal(*other.resource_)) {
+      deallocate_();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+    } else {
+      *this = static_cast<const pmr_buffer_t &>(other);
+    }
+    return *this;
+  }
+
+  ~pmr_buffer_t() { deallocate_(); }
+
+  [[nodiscard]] std::pmr::memory_resource *resource() const noexcept { return resource_; }
+
+  [[nodiscard]] T *data() noexcept { return data_; }
+  [[nodiscard]] const T *data() const noexcept { return data_; }
+  [[nodiscard]] std::size_t size() const noexcept { return size_; }
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  [[nodiscard]] iterator begin() noexcept { return data_; }
+  [[nodiscard]] iterator end() noexcept { return data_ + size_; }
+  [[nodiscard]] const_iterator begin() const noexcept { return data_; }
+  [[nodiscard]] const_iterator end() const noexcept { return data_ + size_; }
+
+  [[nodiscard]] T &operator[](const std::size_t i) noexcept { return data_[i]; }
+  [[nodiscard]] const T &operator[](const std::size_t i) const noexcept { return data_[i]; }
+
+  // Keeps the allocated block for the next fill.
+  void clear() noexcept { size_ = 0; }
+
+  // Returns the block to the resource once the buffer has been emptied.
+  void shrink_to_fit() noexcept {
+    if (size_ == 0) {
+      deallocate_();
+    }
+  }
+
+  void reserve(const std::size_t capacity) {
+    if (capacity <= capacity_) {
+      return;
+    }
+    T *grown = static_cast<T *>(resource_->allocate(capacity * sizeof(T), alignof(T)));
+    if (size_ > 0) {
+      std::memcpy(grown, data_, size_ * sizeof(T));
+    }
+    deallocate_();
+    data_ = grown;
+    capacity_ = capacity;
+  }
+
+  void push_back(const T &value) {
+    if (size_ == capacity_) {
+      grow_(size_ + 1);
+    }
+    data_[size_++] = value;
+  }
+
+  void append(const T *first, const std::size_t count) {
+    if (count == 0) {
+      return;
+    }
+    if (size_ + count > capacity_) {
+      grow_(size_ + count);
+    }
+    std::memcpy(data_ + size_, first, count * sizeof(T));
+    size_ += count;
+  }
+
+  // Replaces the contents with `count` copies of `value`.
+  void assign(const std::size_t count, const T &value) {
+    clear();
+    reserve(count);
+    std::fill_n(data_, count, value);
+    size_ = count;
+  }
+
+private:
+  std::pmr::memory_resource *resource_;
+  T *data_{nullptr};
+  std::size_t size_{0};
+  std::size_t capacity_{0};
+
+  void grow_(const std::size_t needed) {
+    reserve(std::max({needed, capacity_ * 2, 64 / sizeof(T) + 1}));
+  }
+
+  void deallocate_() noexcept {
+    if (data_ != nullptr) {
+      resource_->deallocate(data_, capacity_ * sizeof(T), alignof(T));
+      data_ = nullptr;
+      capacity_ = 0;
+    }
+  }
+};
+
+} // namespace nutsloop::args::detail
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace nutsloop::args {
+
+/**
+ * Holder of an immutable value, such as a snapshot_t, that one thread
+ * replaces while many others read it.
+ *
+ * @code
+ * nutsloop::args::published_t<nutsloop::args::snapshot_t> config;
+ * config.emplace(parser.snapshot());
+ *
+ * // worker thread
+ * auto reader = config.reader();
+ * for (;;) {
+ *   auto threads = reader->get_arg<unsigned long long>("threads");
+ * }
+ *
+ * // on SIGHUP, from the reloading thread
+ * config.emplace(reloaded.snapshot());
+ * @endcode
+ *
+ * Each reading thread owns a reader_t. While the value is unchanged, a read
+ * is one acquire load of the current value, which is written only by
+ * publish(), and takes no lock. After a publish, each reader announces the
+ * value it moves to in a hazard slot on its own cache line. A replaced value
+ * is freed by the publishing thread once no slot names it: in publish(), or
+ * in reclaim() when readers were still on it then.
+ *
+ * Publishing and creating or destroying readers take a mutex; reads never do.
+ * Every reader_t must be destroyed before the holder.
+ */
+template <typename T> class published_t {
+  struct node_t_;
+  struct slot_t_;
+
+public:
+  class reader_t {
+  public:
+    reader_t(reader_t &&other) noexcept;
+    reader_t &operator=(reader_t &&other) noexcept;
+    reader_t(const reader_t &) = delete;
+    reader_t &operator=(const reader_t &) = delete;
+    ~reader_t();
+
+    /**
+     * The value published last, or nullptr when nothing was published. It
+     * stays valid until the next get() of this reader, which may move it to
+     * a newer value, or until the reader is destroyed.
+     */
+    [[nodiscard]] const T *get();
+    [[nodiscard]] const T &operator*() { return *get(); }
+    [[nodiscard]] const T *operator->() { return get(); }
+
+    // Generation of the value the last get() returned, 0 before any.
+    [[nodiscard]] std::uint64_t generation() const noexcept;
+
+  private:
+    friend class published_t;
+
+    published_t *owner_;
+    slot_t_ *slot_;
+    const node_t_ *cached_{nullptr};
+
+    reader_t(published_t &owner, slot_t_ &slot) : owner_(&owner), slot_(&slot) {}
+
+    void release_() noexcept;
+  };
+
+  published_t() = default;
+  explicit published_t(std::unique_ptr<const T> value) { publish(std::move(value)); }
+  published_t(const published_t &) = delete;
+  published_t &operator=(const published_t &) = delete;
+  ~published_t();
+
+  /**
+   * Makes `value` the value readers see from their next get() and returns
+   * its generation, counted from 1. Replaced values that no reader holds are
+   * freed before returning.
+   */
+  std::uint64_t publish(std::unique_ptr<const T> value);
+
+  // publish() of a T built from `args`.
+  template <typename... Args> std::uint64_t emplace(Args &&...args) {
+    return publish(std::make_unique<const T>(std::forward<Args>(args)...));
+  }
+
+  // Frees the replaced values no reader holds anymore; returns how many are
+  // still held.
+  std::size_t reclaim();
+
+  // Generation of the value published last, 0 before any.
+  [[nodiscard]] std::uint64_t generation() const noexcept {
+    return generation_.load(std::memory_order_acquire);
+  }
+
+  // Registers a reader for the calling thread; reuses the slot of a
+  // destroyed one when there is one.
+  [[nodiscard]] reader_t reader();
+
+private:
+  struct node_t_ {
+    std::unique_ptr<const T> value;
+    std::uint64_t generation;
+  };
+
+  // One cache line per reader, written only by that reader and read by the
+  // publisher when it reclaims.
+  struct alignas(64) slot_t_ {
+    std::atomic<const node_t_ *> hazard{nullptr};
+    bool used{false};
+  };
+
+  // alone on its line: readers load it on every get(), publish() stores it.
+  alignas(64) std::atomic<const node_t_ *> current_{nullptr};
+
+  alignas(64) std::mutex mutex_;
+  std::atomic<std::uint64_t> generation_{0};
+  std::vector<std::unique_ptr<slot_t_>> slots_;
+  std::vector<const node_t_ *> retired_;
+
+  // Frees retired values no slot names; the caller holds mutex_.
+  void reclaim_();
+};
+
+} // namespace nutsloop::args
+
+#include "args/inline/published.inl"
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "args/option_types.h++"
+#include "args/parse_value.h++"
+#include "args/types/args_hash_t.h++"
+#include "args/types/args_key_value_t.h++"
+#include "args/types/mapped_file_t.h++"
+#include "args/types/resolver_options_t.h++"
+
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+
+namespace nutsloop::args {
+
+/**
+ * Layered lookup on top of a parsed sequencer: argv first, then the
+ * environment under a configurable prefix, then a flat key=value config file.
+ *
+ * @code
+ * nutsloop::args::sequencer<checker> parser(argc, argv);
+ * nutsloop::args::resolver settings(parser, {.env_prefix = "APP_", .config_path = "app.conf"});
+ * auto threads = settings.get_arg<unsigned long long>("threads"); // --threads, APP_THREADS, threads=
+ * @endcode
+ *
+ * Nothing is read up front. The environment is queried for one variable
+ * when a key is first looked up, and the config file is mapped and indexed
+ * the first time a key misses both argv and the environment. Every result,
+ * a miss included, is memoized, so a key is resolved at most once.
+ *
+ * Environment and config values get the same type inference as argv values
+ * (unsigned integers; signed, floating-point, durations and sizes for typed
+ * keys; strings for keys in
+ * skip_digit_check), with the sequencer's key sets unless the options give
+ * their own. An empty value, or a bare key in the config file, is a switch:
+ * `true`, or `false` when the key contains `disable-`, like `--enable-x` and
+ * `--disable-x` on the command line.
+ *
+ * The memo is filled from const lookups, so one resolver must not be shared
+ * between threads without external locking. The sequencer must outlive it.
+ */
+template <typename Sequencer> class resolver {
+
+  using skip_digit_check_list_t_ = std::unordered_set<std::string, args_hash_t, std::equal_to<>>;
+
+  struct resolved_t_ {
+    std::optional<args_key_value_t_> value;
+    resolver_layer_t layer{resolver_layer_t::none};
+  };
+
+public:
+  explicit resolver(const Sequencer &sequencer, resolver_options_t options = {});
+
+  // The value of `key` from the first layer that has it, or nullptr.
+  [[nodiscard]] const args_key_value_t_ *find(std::string_view key) const;
+
+  [[nodiscard]] bool has(const std::string_view key) const { return find(key) != nullptr; }
+
+  /**
+   * sequencer::get_arg<T> over all layers: std::nullopt when no layer has
+   * `key`, and std::invalid_argument when the value found is not a T.
+   */
+  template <OptionTypes T> [[nodiscard]] std::optional<T> get_arg(std::string_view key) const;
+
+  // The layer `key` resolves from, resolver_layer_t::none when none has it.
+  [[nodiscard]] resolver_layer_t layer_of(std::string_view key) const;
+
+private:
+  const Sequencer &sequencer_;
+  std::optional<std::string> env_prefix_;
+  std::optional<std::string> config_path_;
+  std::optional<skip_digit_check_list_t_> skip_digit_check_;
+  std::optional<skip_digit_check_list_t_> typed_keys_;
+
+  mutable std::unordered_map<std::string, resolved_t_, args_hash_t, std::equal_to<>> memo_;
+  mutable std::optional<mapped_file_t> config_file_;
+  mutable std::unordered_map<std::string_view, std::optional<std::string_view>, args_hash_t,
+                             std::equal_to<>>
+      config_entries_;
+  mutable bool config_loaded_{false};
+
+  // Value from argv, which the sequencer already holds, or nullptr.
+  [[nodiscard]] const args_key_value_t_ *from_argv_(std::string_view key) const;
+
+  // Resolves a key that is not in get_args() and memoizes the result.
+  const resolved_t_ &resolve_(std::string_view key) const;
+
+  [[nodiscard]] std::optional<args_key_value_t_> from_environment_(std::string_view key) const;
+
+  [[nodiscard]] std::optional<args_key_value_t_> from_config_file_(std::string_view key) const;
+
+  // Whether values of `key` always stay strings.
+  [[nodiscard]] bool skips_digit_check_(std::string_view key) const;
+
+  // Whether values of `key` may be signed, floating-point, durations or sizes.
+  [[nodiscard]] bool infers_types_(std::string_view key) const;
+
+  // Maps and indexes the config file; runs once, on the first config lookup.
+  void load_config_file_() const;
+
+  // Applies the argv typing rules to a value read from the environment or a
+  // config file; `value` is std::nullopt for a bare switch.
+  [[nodiscard]] args_key_value_t_ interpret_(std::string_view key,
+                                             std::optional<std::string_view> value) const;
+};
+
+} // namespace nutsloop::args
+
+#include "args/inline/resolver.inl"
+#include "args/inline/resolver_layers_.inl"
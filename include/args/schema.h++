@@ -0,0 +1,159 @@
+#pragma once
+
+#include "args/early_exit.h++"
+#include "args/option_types.h++"
+#include "args/parse_value.h++"
+#include "args/perfect_hash.h++"
+#include "args/types/args_t.h++"
+#include "args/types/fixed_string_t.h++"
+#include "args/types/option_t.h++"
+#include "args/types/version_t.h++"
+
+#include <array>
+#include <cstddef>
+#include <format>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace nutsloop::args {
+
+/**
+ * Parser driven by a compile-time option schema.
+ *
+ * Options are declared up front with option_t; the parser fills one typed
+ * slot per option, and keys from argv are resolved through a perfect hash
+ * built at compile time. Lookups by name are template arguments, so they
+ * resolve to a fixed slot and misspelled names or mismatched types fail to
+ * compile instead of throwing.
+ *
+ * @code
+ * using cli = nutsloop::args::schema_sequencer<
+ *     nutsloop::args::option_t<"threads", unsigned long long, "t", 4>,
+ *     nutsloop::args::option_t<"model", std::string, "m", "default">,
+ *     nutsloop::args::option_t<"verbose", bool>>;
+ *
+ * cli parser(argc, argv);
+ * unsigned long long threads = parser.get<"threads">();          // default 4
+ * std::optional<bool> verbose = parser.get<"verbose">();         // no default
+ * @endcode
+ *
+ * The grammar matches sequencer: `-`/`--` prefixes, `key=value`, an optional
+ * leading command, help (`--help`, `--?topic`, `--help=topic`) and version
+ * (`--version`, `-v`) requests that stop parsing. Values are converted to the
+ * declared type instead of being inferred; unknown keys and values that do
+ * not fit the declared type throw std::invalid_argument.
+ */
+template <typename... Options>
+  requires(SchemaOption<Options> && ...)
+class schema_sequencer {
+
+  static constexpr std::size_t option_count_ = sizeof...(Options);
+
+  // name/alias -> option index lookup tables, built at compile time.
+  static constexpr std::size_t alias_count_ = (std::size_t{0} + ... + (Options::alias.empty() ? 0 : 1));
+  static constexpr std::size_t key_count_ = option_count_ + alias_count_;
+
+  static consteval std::array<std::string_view, key_count_> keys_();
+  static consteval std::array<std::size_t, key_count_> key_options_();
+
+  static constexpr auto key_table_ = make_perfect_hash<key_count_>(keys_());
+  static constexpr auto key_options_table_ = key_options_();
+
+  template <std::size_t I> using option_at_ = std::tuple_element_t<I, std::tuple<Options...>>;
+
+  // Values live in one fixed-size array per OptionTypes member; every option
+  // owns the slot slot_of_[index] in the array of its declared type.
+  template <OptionTypes T>
+  static constexpr std::size_t count_of_ =
+      (std::size_t{0} + ... + (std::same_as<typename Options::value_type, T> ? 1 : 0));
+
+  static constexpr std::array<std::size_t, option_count_> type_of_{
+      option_type_index_v<typename Options::value_type>...};
+  static consteval std::array<std::size_t, option_count_> slot_of_();
+  static constexpr auto slot_of_table_ = slot_of_();
+
+  // Position of the option named `name` (long name or alias), or
+  // option_count_ when there is none.
+  static consteval std::size_t index_of_(std::string_view name);
+
+public:
+  explicit schema_sequencer(int argc, char *argv[], const version_opt_t &version = std::nullopt);
+
+  /**
+   * Returns the slot for option `Name` (long name or alias). Options with a
+   * default yield `const T &`; options without one yield
+   * `const std::optional<T> &`, empty when the option was not passed.
+   */
+  template <fixed_string_t Name> [[nodiscard]] decltype(auto) get() const;
+
+  /**
+   * sequencer::get_arg<T> counterpart: the type is checked against the
+   * schema at compile time. Returns std::nullopt when the option was not
+   * passed and has no default.
+   */
+  template <fixed_string_t Name, OptionTypes T> [[nodiscard]] std::optional<T> get_arg() const;
+
+  // Whether option `Name` was passed on the command line (defaults do not count).
+  template <fixed_string_t Name> [[nodiscard]] bool has() const;
+
+  // Runtime form of has<Name>() for keys only known at runtime.
+  [[nodiscard]] bool has(std::string_view key) const;
+
+  // Whether `key` is declared by the schema as a long name or an alias.
+  [[nodiscard]] static constexpr bool is_option(std::string_view key) {
+    return key_table_.find(key) != perfect_hash_t<key_count_>::npos;
+  }
+
+  [[nodiscard]] const args_command_t &get_command() const { return command_; }
+
+  // Help topic when help was requested (`help` for a bare `--help`).
+  [[nodiscard]] const std::optional<std::string> &get_help_topic() const { return help_; }
+
+  // `major.minor.patch`, or `major.minor.patch-suffix`, when a version
+  // request was parsed.
+  [[nodiscard]] const std::optional<std::string> &get_version() const { return version_string_; }
+
+private:
+  template <typename List> struct slot_storage_;
+  template <typename... Ts> struct slot_storage_<std::tuple<Ts...>> {
+    using type = std::tuple<std::array<std::optional<Ts>, count_of_<Ts>>...>;
+  };
+
+  typename slot_storage_<option_types_list_t>::type slots_;
+  std::array<bool, option_count_> passed_{};
+  args_command_t command_;
+  std::optional<std::string> help_;
+  std::optional<std::string> version_string_;
+  version_t version_{};
+
+  template <OptionTypes T> [[nodiscard]] auto &slots_of_() { return std::get<option_type_index_v<T>>(slots_); }
+  template <OptionTypes T> [[nodiscard]] const auto &slots_of_() const {
+    return std::get<option_type_index_v<T>>(slots_);
+  }
+
+  template <typename Option> void set_default_(std::size_t index);
+
+  void parse_(int argc, char *argv[]);
+
+  void store_(std::size_t index, std::string_view key, std::optional<std::string_view> value);
+
+  template <OptionTypes T>
+  void store_as_(std::size_t index, std::string_view key, std::optional<std::string_view> value);
+
+  // Converts the raw value of option `name` (spelled `key` on the command
+  // line) to its declared type; one instantiation per OptionTypes member.
+  template <OptionTypes T>
+  static T convert_(std::string_view key, std::string_view name, std::optional<std::string_view> value);
+
+  static constexpr std::array<std::string_view, option_count_> names_{Options::name...};
+  static constexpr std::array<bool, option_count_> has_default_{Options::has_default...};
+};
+
+} // namespace nutsloop::args
+
+#include "args/inline/schema_sequencer.inl"
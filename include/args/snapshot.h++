@@ -0,0 +1,190 @@
+#pragma once
+
+#include "args/option_types.h++"
+#include "args/payload.h++"
+#include "args/types/args_key_value_t.h++"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace nutsloop::args {
+
+// Layout version written by sequencer::snapshot() and accepted by snapshot_view_t.
+inline constexpr std::uint32_t snapshot_format_version = 1;
+
+namespace detail {
+
+/**
+ * Snapshot layout. Every field has a fixed width and every reference is a
+ * byte offset from the start of the blob, so a blob can be mapped anywhere
+ * and read in place:
+ *
+ *   header    snapshot_header_t_
+ *   entries   entry_count x snapshot_entry_t_, sorted by key
+ *   strings   keys, string values and the command, back to back
+ *
+ * Integers are in the writer's byte order, recorded in `byte_order`.
+ */
+struct snapshot_header_t_ {
+  std::array<char, 8> magic;
+  std::uint32_t format;
+  std::uint32_t byte_order;
+  std::uint64_t size;
+  std::uint32_t entry_count;
+  std::uint32_t command_offset;
+  std::uint32_t command_size;
+  std::uint32_t reserved;
+};
+
+struct snapshot_entry_t_ {
+  std::uint32_t key_offset;
+  std::uint32_t key_size;
+  // to_payload_() of the value; the offset of its text for strings.
+  std::uint64_t payload;
+  std::uint32_t value_size;
+  std::uint8_t type;
+  std::array<std::uint8_t, 3> reserved;
+};
+
+static_assert(sizeof(snapshot_header_t_) == 40 && sizeof(snapshot_entry_t_) == 24);
+
+inline constexpr std::array<char, 8> snapshot_magic_{'n', 'l', 'a', 'r', 'g', 's', '\0', '\x1a'};
+inline constexpr std::uint32_t snapshot_byte_order_ = 0x01020304;
+
+// One entry to write: a key and its value as a variant index and payload,
+// or as `text` for strings.
+struct snapshot_item_t_ {
+  std::string_view key;
+  std::uint8_t type;
+  std::uint64_t payload;
+  std::string_view text;
+};
+
+/**
+ * Writes `items`, sorted by key, and `command` into `dest` and returns the
+ * size of the blob; nothing is written when `dest` is shorter than that.
+ *
+ * @throws std::invalid_argument if the blob would not fit 32-bit offsets.
+ */
+inline std::size_t write_snapshot_(std::span<const snapshot_item_t_> items,
+                                   std::string_view command, std::span<std::byte> dest);
+
+} // namespace detail
+
+/**
+ * Read-only view of a blob written by sequencer::snapshot().
+ *
+ * @code
+ * // supervisor
+ * const auto blob = parser.snapshot();
+ * ::write(memfd, blob.data(), blob.size());
+ *
+ * // worker
+ * auto file = nutsloop::args::mapped_file_t::map(memfd);
+ * nutsloop::args::snapshot_view_t config(std::as_bytes(file->data()));
+ * auto threads = config.get_arg<unsigned long long>("threads");
+ * @endcode
+ *
+ * The view reads the blob in place: lookups are a binary search over the
+ * sorted entries and allocate nothing, except get_arg<std::string>(), which
+ * returns a copy; get_view() returns string values as views. The blob must
+ * outlive the view. It holds what get_command() and get_arg() of the
+ * sequencer returned, one value per key: values repeated for get_all() are
+ * not kept.
+ */
+class snapshot_view_t {
+public:
+  /**
+   * Checks the header and every entry of `blob` once, so lookups need no
+   * bounds checks. `blob` may be longer than the snapshot, as a mapping
+   * rounded up to whole pages is.
+   *
+   * @throws std::invalid_argument if `blob` is not a snapshot of this
+   * format version and byte order, or is truncated or inconsistent.
+   */
+  explicit snapshot_view_t(std::span<const std::byte> blob);
+
+  // Number of keys.
+  [[nodiscard]] std::size_t size() const noexcept { return entry_count_; }
+
+  [[nodiscard]] std::string_view get_command() const noexcept { return command_; }
+
+  // Key of entry `index`, in sorted order.
+  [[nodiscard]] std::string_view key(std::size_t index) const;
+
+  [[nodiscard]] bool has(std::string_view key) const { return find_(key).has_value(); }
+
+  /**
+   * sequencer::get_arg<T>: std::nullopt when the snapshot does not have
+   * `key`, std::invalid_argument when its value is not a T.
+   */
+  template <OptionTypes T> [[nodiscard]] std::optional<T> get_arg(std::string_view key) const;
+
+  // String value of `key` as a view into the blob; std::invalid_argument
+  // when its value is not a string.
+  [[nodiscard]] std::optional<std::string_view> get_view(std::string_view key) const;
+
+private:
+  std::span<const std::byte> blob_;
+  std::size_t entry_count_{0};
+  std::string_view command_;
+
+  [[nodiscard]] detail::snapshot_entry_t_ entry_(std::size_t index) const;
+  [[nodiscard]] std::string_view text_(std::uint64_t offset, std::uint64_t size) const;
+  [[nodiscard]] std::optional<detail::snapshot_entry_t_> find_(std::string_view key) const;
+};
+
+/**
+ * Immutable snapshot that owns its blob, for keeping a configuration apart
+ * from the sequencer that parsed it or sharing it through published_t.
+ *
+ * @code
+ * const nutsloop::args::snapshot_t config(parser.snapshot());
+ * auto threads = config.get_arg<unsigned long long>("threads");
+ * @endcode
+ */
+class snapshot_t {
+public:
+  // @throws std::invalid_argument as snapshot_view_t does.
+  explicit snapshot_t(std::vector<std::byte> blob) : blob_(std::move(blob)), view_(blob_) {}
+
+  // the view points into blob_, which a copy would not share.
+  snapshot_t(const snapshot_t &) = delete;
+  snapshot_t &operator=(const snapshot_t &) = delete;
+
+  [[nodiscard]] const snapshot_view_t &view() const noexcept { return view_; }
+  [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return blob_; }
+
+  [[nodiscard]] std::size_t size() const noexcept { return view_.size(); }
+  [[nodiscard]] std::string_view get_command() const noexcept { return view_.get_command(); }
+  [[nodiscard]] bool has(const std::string_view key) const { return view_.has(key); }
+
+  template <OptionTypes T>
+  [[nodiscard]] std::optional<T> get_arg(const std::string_view key) const {
+    return view_.get_arg<T>(key);
+  }
+
+  [[nodiscard]] std::optional<std::string_view> get_view(const std::string_view key) const {
+    return view_.get_view(key);
+  }
+
+private:
+  const std::vector<std::byte> blob_;
+  const snapshot_view_t view_;
+};
+
+} // namespace nutsloop::args
+
+#include "args/inline/snapshot_view.inl"
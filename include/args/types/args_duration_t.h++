@@ -0,0 +1,10 @@
+#pragma once
+#include <chrono>
+
+namespace nutsloop::args {
+
+// Durations parsed from `250ms`, `5s`, `2h` and the like, at nanosecond
+// resolution; convert with std::chrono::duration_cast as needed.
+using args_duration_t = std::chrono::nanoseconds;
+
+} // namespace nutsloop::args
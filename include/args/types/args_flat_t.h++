@@ -0,0 +1,180 @@
+#pragma once
+#include "args_hash_t.h++"
+#include "args_key_value_t.h++"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace nutsloop::args {
+
+/**
+ * Cache-friendly alternative to args_t.
+ *
+ * Entries live in one contiguous vector in insertion order; keys up to the
+ * SSO size stay inline in the entry. Lookups go through an open-addressing
+ * index of 64-bit slots (32-bit hash tag + entry position) with linear
+ * probing, so a probe touches one small array and compares strings only on
+ * a tag match. Entries are never erased, which keeps positions stable.
+ *
+ * Exposes the subset of the std::unordered_map interface sequencer and its
+ * callers use: operator[], find, contains, at, size, bucket_count,
+ * iteration, ==.
+ */
+class args_flat_t {
+public:
+  using key_type = std::string;
+  using mapped_type = args_key_value_t_;
+  using value_type = std::pair<std::string, mapped_type>;
+  using size_type = std::size_t;
+  using iterator = std::vector<value_type>::iterator;
+  using const_iterator = std::vector<value_type>::const_iterator;
+
+  args_flat_t() = default;
+
+  [[nodiscard]] size_type size() const noexcept { return entries_.size(); }
+  [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+  // Slots of the index; grows when the index is rehashed.
+  [[nodiscard]] size_type bucket_count() const noexcept { return index_.size(); }
+
+  [[nodiscard]] iterator begin() noexcept { return entries_.begin(); }
+  [[nodiscard]] iterator end() noexcept { return entries_.end(); }
+  [[nodiscard]] const_iterator begin() const noexcept { return entries_.begin(); }
+  [[nodiscard]] const_iterator end() const noexcept { return entries_.end(); }
+
+  // Keeps the allocated entry and index buffers for the next fill.
+  void clear() noexcept {
+    entries_.clear();
+    std::fill(index_.begin(), index_.end(), empty_slot_);
+  }
+
+  void reserve(const size_type count) {
+    entries_.reserve(count);
+    if (count * 2 > index_.size()) {
+      rehash_(count * 2);
+    }
+  }
+
+  [[nodiscard]] iterator find(const std::string_view key) noexcept {
+    const auto position = find_position_(key);
+    return position == npos_ ? entries_.end() : entries_.begin() + static_cast<std::ptrdiff_t>(position);
+  }
+
+  [[nodiscard]] const_iterator find(const std::string_view key) const noexcept {
+    const auto position = find_position_(key);
+    return position == npos_ ? entries_.end() : entries_.begin() + static_cast<std::ptrdiff_t>(position);
+  }
+
+  [[nodiscard]] bool contains(const std::string_view key) const noexcept {
+    return find_position_(key) != npos_;
+  }
+
+  [[nodiscard]] mapped_type &at(const std::string_view key) {
+    const auto position = find_position_(key);
+    if (position == npos_) {
+      throw std::out_of_range("args_flat_t::at");
+    }
+    return entries_[position].second;
+  }
+
+  [[nodiscard]] const mapped_type &at(const std::string_view key) const {
+    const auto position = find_position_(key);
+    if (position == npos_) {
+      throw std::out_of_range("args_flat_t::at");
+    }
+    return entries_[position].second;
+  }
+
+  mapped_type &operator[](std::string key) {
+    const auto hash = args_hash_t{}(key);
+    if (const auto position = find_position_(key, hash); position != npos_) {
+      return entries_[position].second;
+    }
+
+    if ((entries_.size() + 1) * 2 > index_.size()) {
+      rehash_(index_.empty() ? 16 : index_.size() * 2);
+    }
+
+    entries_.emplace_back(std::move(key), mapped_type{});
+    insert_slot_(hash, static_cast<std::uint32_t>(entries_.size() - 1));
+    return entries_.back().second;
+  }
+
+  // Same contents regardless of insertion order, like std::unordered_map.
+  [[nodiscard]] friend bool operator==(const args_flat_t &lhs, const args_flat_t &rhs) {
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (const auto &[key, value] : lhs.entries_) {
+      const auto it = rhs.find(key);
+      if (it == rhs.end() || !(it->second == value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  static constexpr std::size_t npos_ = static_cast<std::size_t>(-1);
+  static constexpr std::uint64_t empty_slot_ = 0;
+
+  std::vector<value_type> entries_;
+  std::vector<std::uint64_t> index_;
+
+  // slot = (upper 32 bits of the hash) << 32 | (entry position + 1)
+  [[nodiscard]] static std::uint64_t make_slot_(const std::size_t hash, const std::uint32_t position) {
+    return (static_cast<std::uint64_t>(hash) & 0xFFFFFFFF00000000ULL) | (position + 1ULL);
+  }
+
+  [[nodiscard]] std::size_t find_position_(const std::string_view key) const noexcept {
+    return find_position_(key, args_hash_t{}(key));
+  }
+
+  [[nodiscard]] std::size_t find_position_(const std::string_view key, const std::size_t hash) const noexcept {
+    if (index_.empty()) {
+      return npos_;
+    }
+    const auto mask = index_.size() - 1;
+    const auto tag = static_cast<std::uint64_t>(hash) & 0xFFFFFFFF00000000ULL;
+    for (auto i = hash & mask;; i = (i + 1) & mask) {
+      const auto slot = index_[i];
+      if (slot == empty_slot_) {
+        return npos_;
+      }
+      if ((slot & 0xFFFFFFFF00000000ULL) == tag) {
+        const auto position = static_cast<std::size_t>((slot & 0xFFFFFFFFULL) - 1);
+        if (entries_[position].first == key) {
+          return position;
+        }
+      }
+    }
+  }
+
+  void insert_slot_(const std::size_t hash, const std::uint32_t position) {
+    const auto mask = index_.size() - 1;
+    auto i = hash & mask;
+    while (index_[i] != empty_slot_) {
+      i = (i + 1) & mask;
+    }
+    index_[i] = make_slot_(hash, position);
+  }
+
+  void rehash_(std::size_t slots) {
+    std::size_t size = 16;
+    while (size < slots) {
+      size *= 2;
+    }
+    index_.assign(size, empty_slot_);
+    for (std::uint32_t position = 0; position < entries_.size(); ++position) {
+      insert_slot_(args_hash_t{}(entries_[position].first), position);
+    }
+  }
+};
+
+} // namespace nutsloop::args
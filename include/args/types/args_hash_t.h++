@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace nutsloop::args {
+
+// Transparent hash so string-keyed containers can be probed with a
+// std::string_view (or a literal) without building a temporary std::string.
+struct args_hash_t {
+  using is_transparent = void;
+
+  [[nodiscard]] std::size_t operator()(std::string_view key) const noexcept {
+    return std::hash<std::string_view>{}(key);
+  }
+};
+
+} // namespace nutsloop::args
@@ -0,0 +1,135 @@
+#pragma once
+#include "args_hash_t.h++"
+#include "args_key_value_t.h++"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nutsloop::args {
+
+/**
+ * Interned key returned by sequencer::key().
+ *
+ * A handle is an index into the key table of the sequencer that issued it;
+ * has() and get_arg() on a handle read the value the last parse left for the
+ * key without hashing its name again. Handles stay valid across parse() and
+ * reset(), and in copies of the sequencer.
+ */
+class args_key_t {
+public:
+  constexpr explicit args_key_t(const std::uint32_t index) noexcept : index_(index) {}
+
+  [[nodiscard]] constexpr std::uint32_t index() const noexcept { return index_; }
+
+  friend constexpr bool operator==(args_key_t, args_key_t) noexcept = default;
+
+private:
+  std::uint32_t index_;
+};
+
+namespace detail {
+
+/**
+ * Keys interned through sequencer::key() and where their values are in the
+ * sequencer's storage after the last parse.
+ *
+ * resolve() looks every key up once per parse, so a handle lookup is an
+ * index into `values_`. The positions point into the storage of the
+ * sequencer that resolved them: a copy, or a table that has been
+ * move-assigned to, keeps the keys but drops the positions, and
+ * lookups go by name until the next resolve().
+ */
+class key_table_t {
+public:
+  explicit key_table_t(std::pmr::memory_resource *resource)
+      : names_(resource), ids_(resource), values_(resource) {}
+
+  key_table_t(const key_table_t &other)
+      : names_(other.names_), ids_(other.ids_), values_(other.values_.size(), nullptr) {}
+
+  key_table_t(key_table_t &&) noexcept = default;
+
+  key_table_t &operator=(const key_table_t &other) {
+    if (this != &other) {
+      names_ = other.names_;
+      ids_ = other.ids_;
+      values_.assign(other.values_.size(), nullptr);
+      resolved_ = false;
+    }
+    return *this;
+  }
+
+  key_table_t &operator=(key_table_t &&other) {
+    names_ = std::move(other.names_);
+    ids_ = std::move(other.ids_);
+    values_.assign(names_.size(), nullptr);
+    resolved_ = false;
+    return *this;
+  }
+
+  ~key_table_t() = default;
+
+  [[nodiscard]] std::size_t size() const noexcept { return names_.size(); }
+
+  [[nodiscard]] std::string_view name(const args_key_t key) const { return names_[key.index()]; }
+
+  // Index of `name`, adding it on first use.
+  template <typename Storage> args_key_t intern(const std::string_view name, const Storage &storage) {
+    if (const auto it = ids_.find(name); it != ids_.end()) {
+      return args_key_t(it->second);
+    }
+    const auto index = static_cast<std::uint32_t>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(names_.back(), index);
+    values_.push_back(resolved_ ? find_(storage, name) : nullptr);
+    return args_key_t(index);
+  }
+
+  // Records where every key is in `storage`, which must not change until the
+  // next resolve() or invalidate().
+  template <typename Storage> void resolve(const Storage &storage) {
+    for (std::size_t i = 0; i < names_.size(); ++i) {
+      values_[i] = find_(storage, names_[i]);
+    }
+    resolved_ = true;
+  }
+
+  // Forgets the positions before the storage changes.
+  void invalidate() noexcept { resolved_ = false; }
+
+  // Value of `key`, or nullptr when the storage does not have it.
+  template <typename Storage>
+  [[nodiscard]] const args_key_value_t_ *find(const args_key_t key, const Storage &storage) const {
+    if (resolved_) {
+      return values_[key.index()];
+    }
+    return find_(storage, names_[key.index()]);
+  }
+
+  [[nodiscard]] bool contains(const args_key_t key) const noexcept {
+    return key.index() < names_.size();
+  }
+
+private:
+  std::pmr::vector<std::pmr::string> names_;
+  std::pmr::unordered_map<std::pmr::string, std::uint32_t, args_hash_t, std::equal_to<>> ids_;
+  std::pmr::vector<const args_key_value_t_ *> values_;
+  bool resolved_{false};
+
+  template <typename Storage>
+  [[nodiscard]] static const args_key_value_t_ *find_(const Storage &storage,
+                                                      const std::string_view name) {
+    const auto it = storage.find(name);
+    return it == storage.end() ? nullptr : &it->second;
+  }
+};
+
+} // namespace detail
+
+} // namespace nutsloop::args
@@ -1,11 +1,30 @@
 #pragma once
 
+#include "args_duration_t.h++"
+#include "args_size_t.h++"
+
+#include <concepts>
 #include <cstddef>
 #include <string>
 #include <variant>
 
 namespace nutsloop::args {
 
-using args_key_value_t_ = std::variant<std::string, unsigned long long, bool, std::nullptr_t>;
+// New alternatives are appended after std::nullptr_t so existing indices stay put.
+using args_key_value_t_ = std::variant<std::string, unsigned long long, bool, std::nullptr_t,
+                                       long long, double, args_duration_t, args_size_t>;
+
+namespace detail {
+
+// Index of T among the alternatives of args_key_value_t_.
+template <typename T, std::size_t I = 0> constexpr std::size_t key_value_index_() {
+  if constexpr (std::same_as<std::variant_alternative_t<I, args_key_value_t_>, T>) {
+    return I;
+  } else {
+    return key_value_index_<T, I + 1>();
+  }
+}
+
+} // namespace detail
 
 } // namespace nutsloop::args
@@ -0,0 +1,14 @@
+#pragma once
+#include <compare>
+
+namespace nutsloop::args {
+
+// A byte count parsed from `64KiB`, `2G`, `10MB` and the like. A distinct
+// type, so a size never collides with a plain unsigned long long value.
+struct args_size_t {
+  unsigned long long bytes{0};
+
+  friend constexpr auto operator<=>(const args_size_t &, const args_size_t &) = default;
+};
+
+} // namespace nutsloop::args
@@ -1,4 +1,10 @@
 #pragma once
+#include "args_duration_t.h++"
+#include "args_hash_t.h++"
+#include "args_size_t.h++"
+
+#include <functional>
+#include <memory_resource>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -6,13 +12,36 @@
 
 namespace nutsloop::args {
 
+// Keys are hashed through args_hash_t, so find(), contains() and at() take a
+// std::string_view (or a literal) without building a std::string.
 using args_t =
     std::unordered_map<std::string,
-                       std::variant<std::string, unsigned long long, bool, std::nullptr_t>>;
+                       std::variant<std::string, unsigned long long, bool, std::nullptr_t,
+                                    long long, double, args_duration_t, args_size_t>,
+                       args_hash_t, std::equal_to<>>;
 
 using args_list_t = std::unordered_set<std::string>;
 
 using args_command_t = std::string;
 using args_list_command_t = std::unordered_set<std::string>;
 
+// Allocator-aware counterparts, drawing their memory from a
+// std::pmr::memory_resource. pmr::args_t can back a sequencer built with
+// std::allocator_arg; its keys stay std::string so it keeps the lookup
+// surface of args_t, and short keys live in the map nodes themselves.
+namespace pmr {
+
+using args_t =
+    std::pmr::unordered_map<std::string,
+                            std::variant<std::string, unsigned long long, bool, std::nullptr_t,
+                                         long long, double, args_duration_t, args_size_t>,
+                            args_hash_t, std::equal_to<>>;
+
+using args_list_t = std::pmr::unordered_set<std::pmr::string>;
+
+using args_command_t = std::pmr::string;
+using args_list_command_t = std::pmr::unordered_set<std::pmr::string>;
+
+} // namespace pmr
+
 } // namespace nutsloop::args
\ No newline at end of file
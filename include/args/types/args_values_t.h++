@@ -0,0 +1,391 @@
+#pragma once
+
+#include "args/option_types.h++"
+#include "args/payload.h++"
+#include "args/pmr_buffer.h++"
+#include "args_hash_t.h++"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace nutsloop::args {
+
+// Keys whose values are split on ',' into list elements (`--tags=a,b,c`).
+using list_keys_t = std::optional<std::unordered_set<std::string>>;
+
+// Keys whose values may be signed, floating-point, durations or sizes
+// (`--offset=-3`, `--ratio=0.75`, `--timeout=250ms`, `--buffer=64KiB`);
+// other keys keep only unsigned integers and strings.
+using typed_keys_t = std::optional<std::unordered_set<std::string>>;
+
+// Element type handed out by get_all<T>(): strings are views into the arena,
+// every other option type is returned by value.
+template <typename T> struct args_value_view {
+  using type = T;
+};
+
+template <> struct args_value_view<std::string> {
+  using type = std::string_view;
+};
+
+template <typename T> using args_value_view_t = typename args_value_view<T>::type;
+
+/**
+ * Every value seen for every key, in command-line order.
+ *
+ * While parsing, string values are appended to one character arena and each
+ * occurrence is recorded against a key id; a key is copied into the arena only
+ * the first time it is seen, into a separate key arena that stays small and
+ * cache-resident, and ids are found through an open-addressing index like the
+ * one in args_flat_t. Nothing is allocated per element.
+ * seal() then counting-sorts the records by key id, so the values of one key
+ * and one type sit next to each other in a single column per option type and
+ * can be returned as a span. Records must not be pushed after seal().
+ *
+ * Typed values also record the text they were parsed from, so the string
+ * column holds every value of a key, whatever its type, and a key given
+ * both `1` and `a` can still be read as strings.
+ *
+ * Every buffer is drawn from the std::pmr::memory_resource given at
+ * construction (the default resource otherwise), so a sequencer built over a
+ * monotonic arena keeps all of its values there.
+ */
+class args_values_t {
+
+  template <typename List> struct columns_of_;
+
+  // Returns a column to the memory resource it was drawn from. Column
+  // elements are trivially destructible, so nothing else needs to run.
+  template <typename T> struct column_deleter_t_ {
+    std::pmr::memory_resource *resource;
+    std::size_t size;
+
+    void operator()(T *column) const noexcept {
+      resource->deallocate(column, size * sizeof(T), alignof(T));
+    }
+  };
+
+  template <typename T> using column_t_ = std::unique_ptr<T[], column_deleter_t_<T>>;
+
+  template <typename... Ts> struct columns_of_<std::tuple<Ts...>> {
+    using type = std::tuple<column_t_<args_value_view_t<Ts>>...>;
+  };
+
+  using columns_t_ = typename columns_of_<option_types_list_t>::type;
+  template <std::size_t I>
+  using column_element_t_ = typename std::tuple_element_t<I, columns_t_>::element_type;
+  using counts_t_ = std::array<std::size_t, std::tuple_size_v<option_types_list_t>>;
+
+  // one record list per option type keeps a record at 16 bytes.
+  struct record_t_ {
+    std::uint32_t key;
+    std::uint32_t value_size;
+    // arena offset of a string value, or the value itself for other types.
+    std::uint64_t payload;
+  };
+
+  using records_t_ =
+      std::array<detail::pmr_buffer_t<record_t_>, std::tuple_size_v<option_types_list_t>>;
+
+  // position of a key in the key arena; kept apart from its ranges so the
+  // lookup during parsing touches as little memory as possible.
+  struct key_t_ {
+    std::uint32_t offset;
+    std::uint32_t size;
+  };
+
+  // where the values of one key start in each column, and how many there are.
+  struct range_t_ {
+    counts_t_ first{};
+    counts_t_ count{};
+  };
+
+public:
+  args_values_t() : args_values_t(std::pmr::get_default_resource()) {}
+
+  explicit args_values_t(std::pmr::memory_resource *resource)
+      : arena_(resource), key_arena_(resource),
+        records_(records_for_(resource,
+                              std::make_index_sequence<std::tuple_size_v<option_types_list_t>>{})),
+        keys_(resource), ranges_(resource), index_(resource) {}
+
+  args_values_t(args_values_t &&) noexcept = default;
+
+  // the buffers are taken over only when both sides share a resource;
+  // otherwise the values are copied so that the string views are rebased.
+  args_values_t &operator=(args_values_t &&other) {
+    if (this == &other) {
+      return *this;
+    }
+    if (!arena_.resource()->is_equal(*other.arena_.resource())) {
+      return *this = static_cast<const args_values_t &>(other);
+    }
+    arena_ = std::move(other.arena_);
+    key_arena_ = std::move(other.key_arena_);
+    records_ = std::move(other.records_);
+    keys_ = std::move(other.keys_);
+    ranges_ = std::move(other.ranges_);
+    index_ = std::move(other.index_);
+    totals_ = std::exchange(other.totals_, {});
+    columns_ = std::move(other.columns_);
+    return *this;
+  }
+
+  args_values_t(const args_values_t &other) { *this = other; }
+
+  args_values_t &operator=(const args_values_t &other) {
+    if (this == &other) {
+      return *this;
+    }
+    arena_ = other.arena_;
+    key_arena_ = other.key_arena_;
+    records_ = other.records_;
+    keys_ = other.keys_;
+    ranges_ = other.ranges_;
+    index_ = other.index_;
+    totals_ = other.totals_;
+    copy_columns_(other, std::make_index_sequence<std::tuple_size_v<option_types_list_t>>{});
+
+    // string views follow the arena to its new address.
+    auto &strings = std::get<option_type_index_v<std::string>>(columns_);
+    for (std::size_t i = 0; i < totals_[option_type_index_v<std::string>]; ++i) {
+      strings[i] = {arena_.data() + (strings[i].data() - other.arena_.data()), strings[i].size()};
+    }
+    return *this;
+  }
+
+  void push(const std::string_view key, const std::string_view value) {
+    const std::uint32_t id = key_id_(key);
+    const std::size_t value_offset = append_(arena_, value);
+    record_(id, option_type_index_v<std::string>, value_offset,
+            static_cast<std::uint32_t>(value.size()));
+  }
+
+  // `text` is what `value` was parsed from; it is what values<std::string>()
+  // returns for this value.
+  template <OptionTypes T>
+    requires(!std::same_as<T, std::string>)
+  void push(const std::string_view key, const T value, const std::string_view text) {
+    const std::uint32_t id = key_id_(key);
+    record_(id, option_type_index_v<T>, detail::to_payload_(value), 0);
+    record_(id, option_type_index_v<std::string>, append_(arena_, text),
+            static_cast<std::uint32_t>(text.size()));
+  }
+
+  // Groups the recorded values by key into the per-type columns.
+  void seal() {
+    ranges_.assign(keys_.size(), {});
+    for (std::size_t type = 0; type < records_.size(); ++type) {
+      for (const auto &record : records_[type]) {
+        ++ranges_[record.key].count[type];
+      }
+    }
+    allocate_columns_(std::make_index_sequence<std::tuple_size_v<option_types_list_t>>{});
+
+    // `first` runs ahead as the fill cursor and is rewound afterwards.
+    counts_t_ start{};
+    for (auto &range : ranges_) {
+      for (std::size_t type = 0; type < start.size(); ++type) {
+        range.first[type] = start[type];
+        start[type] += range.count[type];
+      }
+    }
+    store_columns_(std::make_index_sequence<std::tuple_size_v<option_types_list_t>>{});
+    for (auto &range : ranges_) {
+      for (std::size_t type = 0; type < start.size(); ++type) {
+        range.first[type] -= range.count[type];
+      }
+    }
+
+    // the record buffers are kept for the next fill after clear().
+    for (auto &records : records_) {
+      records.clear();
+    }
+  }
+
+  // Forgets every key and value, keeping the arenas, records and columns
+  // allocated so that the next fill of a similar size does not allocate.
+  void clear() {
+    arena_.clear();
+    key_arena_.clear();
+    for (auto &records : records_) {
+      records.clear();
+    }
+    keys_.clear();
+    ranges_.clear();
+    index_.clear();
+    totals_ = {};
+  }
+
+  // Values of type T recorded for `key`, in command-line order. For
+  // std::string, the text of every value recorded for `key`.
+  template <OptionTypes T>
+  [[nodiscard]] std::span<const args_value_view_t<T>> values(const std::string_view key) const {
+    const auto id = find_id_(key, args_hash_t{}(key));
+    if (id == npos_) {
+      return {};
+    }
+    constexpr std::size_t column = option_type_index_v<T>;
+    return {std::get<column>(columns_).get() + ranges_[id].first[column],
+            ranges_[id].count[column]};
+  }
+
+  // Number of values of any type recorded for `key`.
+  [[nodiscard]] std::size_t count(const std::string_view key) const {
+    const auto id = find_id_(key, args_hash_t{}(key));
+    if (id == npos_) {
+      return 0;
+    }
+    // every value has its text in the string column.
+    return ranges_[id].count[option_type_index_v<std::string>];
+  }
+
+private:
+  static constexpr std::size_t npos_ = static_cast<std::size_t>(-1);
+  static constexpr std::uint64_t empty_slot_ = 0;
+
+  detail::pmr_buffer_t<char> arena_;
+  detail::pmr_buffer_t<char> key_arena_;
+  records_t_ records_;
+  detail::pmr_buffer_t<key_t_> keys_;
+  detail::pmr_buffer_t<range_t_> ranges_;
+  detail::pmr_buffer_t<std::uint64_t> index_;
+  counts_t_ totals_{};
+  columns_t_ columns_;
+
+  template <std::size_t... I>
+  static records_t_ records_for_(std::pmr::memory_resource *resource, std::index_sequence<I...>) {
+    return {((void)I, detail::pmr_buffer_t<record_t_>(resource))...};
+  }
+
+  static std::size_t append_(detail::pmr_buffer_t<char> &arena, const std::string_view text) {
+    const std::size_t offset = arena.size();
+    arena.append(text.data(), text.size());
+    return offset;
+  }
+
+  void record_(const std::uint32_t key, const std::size_t type, const std::uint64_t payload,
+               const std::uint32_t value_size) {
+    records_[type].push_back({key, value_size, payload});
+    ++totals_[type];
+  }
+
+  [[nodiscard]] std::string_view key_at_(const std::size_t id) const {
+    return {key_arena_.data() + keys_[id].offset, keys_[id].size};
+  }
+
+  // slot = (upper 32 bits of the hash) << 32 | (key id + 1), as in args_flat_t.
+  [[nodiscard]] std::size_t find_id_(const std::string_view key, const std::size_t hash) const {
+    if (index_.empty()) {
+      return npos_;
+    }
+    const auto mask = index_.size() - 1;
+    const auto tag = static_cast<std::uint64_t>(hash) & 0xFFFFFFFF00000000ULL;
+    for (auto i = hash & mask;; i = (i + 1) & mask) {
+      const auto slot = index_[i];
+      if (slot == empty_slot_) {
+        return npos_;
+      }
+      if ((slot & 0xFFFFFFFF00000000ULL) == tag) {
+        const auto id = static_cast<std::size_t>((slot & 0xFFFFFFFFULL) - 1);
+        if (key_at_(id) == key) {
+          return id;
+        }
+      }
+    }
+  }
+
+  std::uint32_t key_id_(const std::string_view key) {
+    const auto hash = args_hash_t{}(key);
+    if (const auto id = find_id_(key, hash); id != npos_) {
+      return static_cast<std::uint32_t>(id);
+    }
+
+    if ((keys_.size() + 1) * 2 > index_.size()) {
+      rehash_(index_.empty() ? 16 : index_.size() * 2);
+    }
+
+    const auto id = static_cast<std::uint32_t>(keys_.size());
+    keys_.push_back({static_cast<std::uint32_t>(append_(key_arena_, key)),
+                     static_cast<std::uint32_t>(key.size())});
+    insert_slot_(hash, id);
+    return id;
+  }
+
+  void insert_slot_(const std::size_t hash, const std::uint32_t id) {
+    const auto mask = index_.size() - 1;
+    auto i = hash & mask;
+    while (index_[i] != empty_slot_) {
+      i = (i + 1) & mask;
+    }
+    index_[i] = (static_cast<std::uint64_t>(hash) & 0xFFFFFFFF00000000ULL) | (id + 1ULL);
+  }
+
+  void rehash_(const std::size_t slots) {
+    index_.assign(slots, empty_slot_);
+    for (std::uint32_t id = 0; id < keys_.size(); ++id) {
+      insert_slot_(args_hash_t{}(key_at_(id)), id);
+    }
+  }
+
+  template <std::size_t I> void store_column_() {
+    auto &column = std::get<I>(columns_);
+    for (const auto &record : records_[I]) {
+      auto &value = column[ranges_[record.key].first[I]++];
+      if constexpr (std::same_as<column_element_t_<I>, std::string_view>) {
+        value = std::string_view(arena_.data() + record.payload, record.value_size);
+      } else {
+        value = detail::from_payload_<column_element_t_<I>>(record.payload);
+      }
+    }
+  }
+
+  template <std::size_t... I> void store_columns_(std::index_sequence<I...>) {
+    (store_column_<I>(), ...);
+  }
+
+  template <typename T> column_t_<T> allocate_column_(const std::size_t size) const {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>);
+    if (size == 0) {
+      return {};
+    }
+    auto *resource = arena_.resource();
+    auto *column = static_cast<T *>(resource->allocate(size * sizeof(T), alignof(T)));
+    std::uninitialized_value_construct_n(column, size);
+    return column_t_<T>(column, {resource, size});
+  }
+
+  // columns only grow, so a sealed fill after clear() reuses them.
+  template <std::size_t I> void reserve_column_() {
+    auto &column = std::get<I>(columns_);
+    if (!column || column.get_deleter().size < totals_[I]) {
+      column = allocate_column_<column_element_t_<I>>(totals_[I]);
+    }
+  }
+
+  template <std::size_t... I> void allocate_columns_(std::index_sequence<I...>) {
+    (reserve_column_<I>(), ...);
+  }
+
+  template <std::size_t... I>
+  void copy_columns_(const args_values_t &other, std::index_sequence<I...>) {
+    ((std::get<I>(columns_) = allocate_column_<column_element_t_<I>>(totals_[I]),
+      std::copy_n(std::get<I>(other.columns_).get(), totals_[I], std::get<I>(columns_).get())),
+     ...);
+  }
+};
+
+} // namespace nutsloop::args
@@ -0,0 +1,26 @@
+#pragma once
+#include "args_values_t.h++"
+#include "skip_digit_check_t.h++"
+#include "version_t.h++"
+
+#include <cstddef>
+#include <optional>
+
+namespace nutsloop::args {
+
+struct batch_options_t {
+  // Worker threads; 0 uses std::thread::hardware_concurrency().
+  std::size_t threads{0};
+
+  // Lines a worker claims at a time. Larger chunks mean less contention on
+  // the shared counter, smaller ones a more even split of uneven lines.
+  std::size_t chunk_size{512};
+
+  // Passed to the sequencer each worker parses with.
+  skip_digit_check_t skip_digit_check{std::nullopt};
+  version_opt_t version{std::nullopt};
+  list_keys_t list_keys{std::nullopt};
+  typed_keys_t typed_keys{std::nullopt};
+};
+
+} // namespace nutsloop::args
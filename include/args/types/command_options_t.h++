@@ -0,0 +1,21 @@
+#pragma once
+#include "args_values_t.h++"
+#include "skip_digit_check_t.h++"
+#include "switch_set_t.h++"
+#include "version_t.h++"
+
+#include <optional>
+
+namespace nutsloop::args {
+
+// Configuration of one command's sequencer, as its constructor takes it.
+// A command_tree asks for it only when the command is first selected.
+struct command_options_t {
+  skip_digit_check_t skip_digit_check{std::nullopt};
+  version_opt_t version{std::nullopt};
+  list_keys_t list_keys{std::nullopt};
+  switches_t switches{std::nullopt};
+  typed_keys_t typed_keys{std::nullopt};
+};
+
+} // namespace nutsloop::args
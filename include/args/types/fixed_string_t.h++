@@ -0,0 +1,19 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
+namespace nutsloop::args {
+
+// String literal usable as a non-type template parameter, e.g.
+// `option_t<"threads", unsigned long long>`.
+template <std::size_t N> struct fixed_string_t {
+  char value[N]{};
+
+  consteval fixed_string_t(const char (&literal)[N]) { std::copy_n(literal, N, value); }
+
+  [[nodiscard]] constexpr std::string_view view() const { return {value, N - 1}; }
+  [[nodiscard]] constexpr bool empty() const { return N == 1; }
+};
+
+} // namespace nutsloop::args
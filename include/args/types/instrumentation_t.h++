@@ -0,0 +1,245 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace nutsloop::args {
+
+// Instrumentation policies select whether sequencer records parse_stats_t.
+// no_instrumentation_t records nothing and adds nothing to the sequencer (default).
+// instrumented_t records the stats of every parse and reports them to a callback.
+struct no_instrumentation_t {};
+struct instrumented_t {};
+
+// Phases of a parse timed by instrumented_t.
+enum class parse_phase_t : std::uint8_t {
+  scan,   // find_early_exit() over argv
+  split,  // dashes, `=` and key of each token
+  infer,  // detection and conversion of numeric, duration and size values
+  store,  // insertion into get_args() storage and the get_all() arena
+  finish, // grouping repeated values and resolving interned keys
+};
+
+inline constexpr std::size_t parse_phase_count = 5;
+
+/**
+ * What one parse did, as recorded by instrumented_t.
+ *
+ * Phase times are summed over the tokens of the parse; `total` also covers
+ * the command, response files and the checks between phases. Allocations and
+ * bytes are those drawn from the sequencer's memory resource, which holds all
+ * parse state when Storage is a std::pmr container; std::string values past
+ * the small-string buffer and a non-pmr Storage such as args_t allocate from
+ * the global heap and are not counted.
+ */
+struct parse_stats_t {
+  std::array<std::chrono::nanoseconds, parse_phase_count> phases{};
+  std::chrono::nanoseconds total{0};
+
+  std::size_t allocations{0};
+  std::size_t allocated_bytes{0};
+
+  // arguments by kind.
+  std::size_t enable_switches{0};
+  std::size_t disable_switches{0};
+  std::size_t truthy_switches{0};
+  std::size_t registered_switches{0};
+  std::size_t string_values{0};
+  std::size_t numeric_values{0};
+  std::size_t list_values{0};
+  std::size_t response_files{0};
+
+  // times the storage grew its bucket or slot table.
+  std::size_t rehashes{0};
+
+  [[nodiscard]] std::chrono::nanoseconds phase(const parse_phase_t phase) const {
+    return phases[static_cast<std::size_t>(phase)];
+  }
+};
+
+using parse_stats_callback_t = std::function<void(const parse_stats_t &)>;
+
+template <typename Instrumentation>
+concept ArgsInstrumentation = std::same_as<Instrumentation, no_instrumentation_t> ||
+                              std::same_as<Instrumentation, instrumented_t>;
+
+namespace detail {
+
+// Kinds of argument counted in parse_stats_t.
+enum class arg_kind_t : std::uint8_t {
+  enable_switch,
+  disable_switch,
+  truthy_switch,
+  registered_switch,
+  string_value,
+  numeric_value,
+  list_value,
+  response_file,
+};
+
+// Memory resource that counts what it forwards to `upstream`.
+class counting_resource_t final : public std::pmr::memory_resource {
+public:
+  explicit counting_resource_t(std::pmr::memory_resource *upstream) : upstream_(upstream) {}
+
+  [[nodiscard]] std::size_t allocations() const noexcept { return allocations_; }
+  [[nodiscard]] std::size_t bytes() const noexcept { return bytes_; }
+
+private:
+  std::pmr::memory_resource *upstream_;
+  std::size_t allocations_{0};
+  std::size_t bytes_{0};
+
+  void *do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+    ++allocations_;
+    bytes_ += bytes;
+    return upstream_->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *pointer, const std::size_t bytes,
+                     const std::size_t alignment) override {
+    upstream_->deallocate(pointer, bytes, alignment);
+  }
+
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+/**
+ * Records parse_stats_t for a sequencer. The no_instrumentation_t
+ * specialization below has the same members, all empty, so the calls in the
+ * parse compile away.
+ */
+template <typename Instrumentation> class parse_recorder_t {
+public:
+  class timer_t {
+  public:
+    timer_t(std::chrono::nanoseconds &slot)
+        : slot_(slot), start_(std::chrono::steady_clock::now()) {}
+    timer_t(const timer_t &) = delete;
+    timer_t &operator=(const timer_t &) = delete;
+    ~timer_t() { slot_ += std::chrono::steady_clock::now() - start_; }
+
+  private:
+    std::chrono::nanoseconds &slot_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  // Counts the allocations of `upstream` made through the returned resource.
+  // The counter is shared by copies, so containers of a moved-from or copied
+  // sequencer never point at a destroyed resource.
+  std::pmr::memory_resource *track(std::pmr::memory_resource *upstream) {
+    resource_ = std::make_shared<counting_resource_t>(upstream);
+    return resource_.get();
+  }
+
+  void on_parse(parse_stats_callback_t callback) { callback_ = std::move(callback); }
+
+  [[nodiscard]] const parse_stats_t &stats() const noexcept { return stats_; }
+
+  template <typename Storage> void begin(const Storage &storage) {
+    current_ = {};
+    allocations_ = resource_->allocations();
+    bytes_ = resource_->bytes();
+    buckets_ = buckets_of_(storage);
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  [[nodiscard]] timer_t time(const parse_phase_t phase) {
+    return timer_t(current_.phases[static_cast<std::size_t>(phase)]);
+  }
+
+  void count(const arg_kind_t kind) {
+    switch (kind) {
+    case arg_kind_t::enable_switch:
+      ++current_.enable_switches;
+      break;
+    case arg_kind_t::disable_switch:
+      ++current_.disable_switches;
+      break;
+    case arg_kind_t::truthy_switch:
+      ++current_.truthy_switches;
+      break;
+    case arg_kind_t::registered_switch:
+      ++current_.registered_switches;
+      break;
+    case arg_kind_t::string_value:
+      ++current_.string_values;
+      break;
+    case arg_kind_t::numeric_value:
+      ++current_.numeric_values;
+      break;
+    case arg_kind_t::list_value:
+      ++current_.list_values;
+      break;
+    case arg_kind_t::response_file:
+      ++current_.response_files;
+      break;
+    }
+  }
+
+  // Called after every insertion into `storage`.
+  template <typename Storage> void stored(const Storage &storage) {
+    if (const auto buckets = buckets_of_(storage); buckets != buckets_) {
+      ++current_.rehashes;
+      buckets_ = buckets;
+    }
+  }
+
+  // Publishes the stats of the parse begun last; a parse that throws never
+  // gets here and leaves the previous stats in place.
+  void end() {
+    current_.total = std::chrono::steady_clock::now() - start_;
+    current_.allocations = resource_->allocations() - allocations_;
+    current_.allocated_bytes = resource_->bytes() - bytes_;
+    stats_ = current_;
+    if (callback_) {
+      callback_(stats_);
+    }
+  }
+
+private:
+  std::shared_ptr<counting_resource_t> resource_;
+  parse_stats_callback_t callback_;
+  parse_stats_t stats_;
+  parse_stats_t current_;
+  std::chrono::steady_clock::time_point start_;
+  std::size_t allocations_{0};
+  std::size_t bytes_{0};
+  std::size_t buckets_{0};
+
+  // Storage without a bucket_count() is never seen to rehash.
+  template <typename Storage> [[nodiscard]] static std::size_t buckets_of_(const Storage &storage) {
+    if constexpr (requires { storage.bucket_count(); }) {
+      return static_cast<std::size_t>(storage.bucket_count());
+    } else {
+      return 0;
+    }
+  }
+};
+
+template <> class parse_recorder_t<no_instrumentation_t> {
+public:
+  struct timer_t {};
+
+  static std::pmr::memory_resource *track(std::pmr::memory_resource *upstream) noexcept {
+    return upstream;
+  }
+  template <typename Storage> static void begin(const Storage &) noexcept {}
+  [[nodiscard]] static timer_t time(parse_phase_t) noexcept { return {}; }
+  static void count(arg_kind_t) noexcept {}
+  template <typename Storage> static void stored(const Storage &) noexcept {}
+  static void end() noexcept {}
+};
+
+} // namespace detail
+
+} // namespace nutsloop::args
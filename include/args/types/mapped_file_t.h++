@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) &&      \
+    __has_include(<unistd.h>)
+#define NUTSLOOP_ARGS_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define NUTSLOOP_ARGS_HAS_MMAP 0
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#endif
+
+namespace nutsloop::args {
+
+/**
+ * Read-only file contents exposed as a writable private buffer.
+ *
+ * On POSIX the file is mapped with MAP_PRIVATE, so callers may rewrite bytes
+ * in place (e.g. to strip quotes) and only the touched pages are copied; the
+ * file on disk never changes. Elsewhere the contents are read into memory.
+ */
+class mapped_file_t {
+public:
+  // Identifies the underlying file, to detect a response file including itself.
+  using identity_t = std::pair<std::uint64_t, std::uint64_t>;
+
+  // Returns std::nullopt when `path` cannot be opened or mapped.
+  [[nodiscard]] static std::optional<mapped_file_t> open(const std::string &path) {
+#if NUTSLOOP_ARGS_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return std::nullopt;
+    }
+
+    auto file = map(fd);
+#if defined(MADV_SEQUENTIAL)
+    if (file && file->size_ > 0) {
+      ::madvise(file->data_, file->size_, MADV_SEQUENTIAL);
+    }
+#endif
+    ::close(fd);
+    return file;
+#else
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+      return std::nullopt;
+    }
+
+    mapped_file_t file;
+    file.buffer_.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    file.data_ = file.buffer_.data();
+    file.size_ = file.buffer_.size();
+
+    std::error_code error;
+    const auto canonical = std::filesystem::weakly_canonical(path, error).string();
+    file.identity_ = {std::hash<std::string>{}(canonical), 0};
+    return file;
+#endif
+  }
+
+#if NUTSLOOP_ARGS_HAS_MMAP
+  /**
+   * Maps the regular file open on `fd`, such as a memfd or a shared memory
+   * object handed down by a parent process. `fd` stays open and owned by the
+   * caller. Returns std::nullopt when it cannot be mapped.
+   */
+  [[nodiscard]] static std::optional<mapped_file_t> map(const int fd) {
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+      return std::nullopt;
+    }
+
+    mapped_file_t file;
+    file.size_ = static_cast<std::size_t>(info.st_size);
+    file.identity_ = {static_cast<std::uint64_t>(info.st_dev), static_cast<std::uint64_t>(info.st_ino)};
+
+    if (file.size_ > 0) {
+      void *data = ::mmap(nullptr, file.size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        file.size_ = 0;
+        return std::nullopt;
+      }
+      file.data_ = static_cast<char *>(data);
+    }
+    return file;
+  }
+#endif
+
+  mapped_file_t(const mapped_file_t &) = delete;
+  mapped_file_t &operator=(const mapped_file_t &) = delete;
+
+  mapped_file_t(mapped_file_t &&other) noexcept { *this = std::move(other); }
+
+  mapped_file_t &operator=(mapped_file_t &&other) noexcept {
+    if (this != &other) {
+      release_();
+#if NUTSLOOP_ARGS_HAS_MMAP
+      data_ = std::exchange(other.data_, nullptr);
+#else
+      buffer_ = std::move(other.buffer_);
+      data_ = buffer_.data();
+      other.data_ = nullptr;
+#endif
+      size_ = std::exchange(other.size_, 0);
+      identity_ = other.identity_;
+    }
+    return *this;
+  }
+
+  ~mapped_file_t() { release_(); }
+
+  [[nodiscard]] std::span<char> data() noexcept { return {data_, size_}; }
+  [[nodiscard]] const identity_t &identity() const noexcept { return identity_; }
+
+private:
+  char *data_{nullptr};
+  std::size_t size_{0};
+  identity_t identity_{};
+#if !NUTSLOOP_ARGS_HAS_MMAP
+  std::string buffer_;
+#endif
+
+  mapped_file_t() = default;
+
+  void release_() noexcept {
+#if NUTSLOOP_ARGS_HAS_MMAP
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+  }
+};
+
+} // namespace nutsloop::args
@@ -0,0 +1,140 @@
+#pragma once
+#include "../option_types.h++"
+#include "../parse_value.h++"
+#include "fixed_string_t.h++"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace nutsloop::args {
+
+// Marker for an option declared without a default value.
+struct no_default_t {};
+
+// Structural holder for an option default, so a string literal, an integer,
+// a floating-point literal or a bool can all be written directly in the
+// option_t argument list.
+struct option_default_t {
+  enum class kind_t { none, string, number, negative, floating, boolean };
+
+  static constexpr std::size_t max_text_size = 128;
+
+  kind_t kind{kind_t::none};
+  unsigned long long number{0};
+  long long negative{0};
+  double floating{0};
+  bool boolean{false};
+  char text[max_text_size]{};
+  std::size_t text_size{0};
+
+  consteval option_default_t(no_default_t) {}
+
+  template <std::size_t N> consteval option_default_t(const char (&literal)[N]) : kind(kind_t::string) {
+    static_assert(N <= max_text_size, "option_default_t: default string is too long.");
+    std::copy_n(literal, N - 1, text);
+    text_size = N - 1;
+  }
+
+  template <std::integral I> consteval option_default_t(I value) {
+    if constexpr (std::same_as<I, bool>) {
+      kind = kind_t::boolean;
+      boolean = value;
+    } else if (value < 0) {
+      kind = kind_t::negative;
+      negative = static_cast<long long>(value);
+    } else {
+      kind = kind_t::number;
+      number = static_cast<unsigned long long>(value);
+    }
+  }
+
+  consteval option_default_t(const double value) : kind(kind_t::floating), floating(value) {}
+
+  [[nodiscard]] constexpr std::string_view view() const { return {text, text_size}; }
+};
+
+// Compile-time declaration of one option for schema_sequencer.
+//
+// Name    long name, matched after stripping `--` or `-`.
+// T       value type, one of OptionTypes.
+// Alias   optional short name, e.g. "t" for `-t=4`.
+// Default optional default value: a string literal for std::string, an
+//         integer for unsigned long long and long long, a floating-point or
+//         integer literal for double, `true`/`false` for bool, and a string
+//         literal such as "250ms" or "64KiB" for durations and sizes.
+template <fixed_string_t Name, OptionTypes T, fixed_string_t Alias = "",
+          option_default_t Default = no_default_t{}>
+struct option_t {
+  using value_type = T;
+  using kind_t = option_default_t::kind_t;
+
+  static constexpr std::string_view name = Name.view();
+  static constexpr std::string_view alias = Alias.view();
+  static constexpr bool has_default = Default.kind != kind_t::none;
+
+  // Whether Default can initialise a T; durations and sizes are parsed here,
+  // so a malformed default fails to compile.
+  static consteval bool default_matches_() {
+    if constexpr (std::same_as<T, std::string>) {
+      return Default.kind == kind_t::string;
+    } else if constexpr (std::same_as<T, unsigned long long>) {
+      return Default.kind == kind_t::number;
+    } else if constexpr (std::same_as<T, long long>) {
+      constexpr auto max = static_cast<unsigned long long>(std::numeric_limits<long long>::max());
+      return Default.kind == kind_t::negative ||
+             (Default.kind == kind_t::number && Default.number <= max);
+    } else if constexpr (std::same_as<T, double>) {
+      return Default.kind == kind_t::floating || Default.kind == kind_t::number ||
+             Default.kind == kind_t::negative;
+    } else if constexpr (std::same_as<T, args_duration_t>) {
+      return Default.kind == kind_t::string && detail::parse_duration_(Default.view()).has_value();
+    } else if constexpr (std::same_as<T, args_size_t>) {
+      return Default.kind == kind_t::string &&
+             detail::parse_size_(Default.view(), true).has_value();
+    } else {
+      return Default.kind == kind_t::boolean;
+    }
+  }
+
+  static_assert(!name.empty(), "option_t: the option name must not be empty.");
+  static_assert(!has_default || default_matches_(),
+                "option_t: the default value does not match the option type.");
+
+  [[nodiscard]] static T default_value()
+    requires has_default
+  {
+    if constexpr (std::same_as<T, std::string>) {
+      return std::string(Default.view());
+    } else if constexpr (std::same_as<T, unsigned long long>) {
+      return Default.number;
+    } else if constexpr (std::same_as<T, long long>) {
+      return Default.kind == kind_t::negative ? Default.negative
+                                              : static_cast<long long>(Default.number);
+    } else if constexpr (std::same_as<T, double>) {
+      return Default.kind == kind_t::floating   ? Default.floating
+             : Default.kind == kind_t::negative ? static_cast<double>(Default.negative)
+                                                : static_cast<double>(Default.number);
+    } else if constexpr (std::same_as<T, args_duration_t>) {
+      return *detail::parse_duration_(Default.view());
+    } else if constexpr (std::same_as<T, args_size_t>) {
+      return *detail::parse_size_(Default.view(), true);
+    } else {
+      return Default.boolean;
+    }
+  }
+};
+
+template <typename T> struct is_option_t : std::false_type {};
+
+template <fixed_string_t Name, OptionTypes T, fixed_string_t Alias, option_default_t Default>
+struct is_option_t<option_t<Name, T, Alias, Default>> : std::true_type {};
+
+template <typename T>
+concept SchemaOption = is_option_t<T>::value;
+
+} // namespace nutsloop::args
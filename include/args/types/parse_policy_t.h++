@@ -0,0 +1,11 @@
+#pragma once
+
+namespace nutsloop::args {
+
+// Parse policies select where sequencer runs parse_() during construction.
+// parse_sync_t parses on the calling thread (default).
+// parse_threaded_t parses on a dedicated thread and joins before returning.
+struct parse_sync_t {};
+struct parse_threaded_t {};
+
+} // namespace nutsloop::args
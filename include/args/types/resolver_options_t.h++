@@ -0,0 +1,30 @@
+#pragma once
+#include "skip_digit_check_t.h++"
+
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+namespace nutsloop::args {
+
+// Where resolver found the value of a key.
+enum class resolver_layer_t { none, argv, environment, config_file };
+
+struct resolver_options_t {
+  // Environment layer: key `max-threads` is read from `<prefix>MAX_THREADS`.
+  // std::nullopt disables the layer; an empty prefix reads `MAX_THREADS`.
+  std::optional<std::string> env_prefix{std::nullopt};
+
+  // Config file layer: flat `key=value` lines. std::nullopt disables it.
+  std::optional<std::string> config_path{std::nullopt};
+
+  // Keys whose environment and config values always stay strings.
+  // std::nullopt uses the sequencer's skip_digit_check().
+  skip_digit_check_t skip_digit_check{std::nullopt};
+
+  // Keys whose environment and config values may be signed, floating-point,
+  // durations or sizes. std::nullopt uses the sequencer's typed_keys().
+  std::optional<std::unordered_set<std::string>> typed_keys{std::nullopt};
+};
+
+} // namespace nutsloop::args
@@ -0,0 +1,243 @@
+#pragma once
+#include "args/error.h++"
+#include "args_hash_t.h++"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace nutsloop::args {
+
+// Names of the boolean switches a sequencer keeps in a switch_set_t, without
+// the `enable-`/`disable-` prefix: "cache" covers --cache, --enable-cache and
+// --disable-cache. The position of a name is its bit.
+using switches_t = std::optional<std::vector<std::string>>;
+
+/**
+ * Registered boolean switches as dense bitsets, one bit per switch.
+ *
+ * `--enable-X` and `--X` turn switch X on, `--disable-X` turns it off; giving
+ * both `--enable-X` and `--disable-X` throws args::error. The state of every
+ * switch is one word array, so masks of switches are tested a word at a time
+ * and the enabled set is iterated by scanning set bits.
+ */
+class switch_set_t {
+public:
+  using word_t = std::uint64_t;
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  explicit switch_set_t(std::pmr::memory_resource *resource)
+      : names_(resource), ids_(resource), enabled_(resource), given_enable_(resource),
+        given_disable_(resource), given_plain_(resource) {}
+
+  // Registers `names` after the ones already known; repeated names keep
+  // their first bit.
+  void assign(const std::vector<std::string> &names) {
+    for (const std::string_view name : names) {
+      if (ids_.contains(name)) {
+        continue;
+      }
+      ids_.emplace(name, names_.size());
+      names_.emplace_back(name);
+    }
+    const auto words = (names_.size() + 63) / 64;
+    for (auto *bits : {&enabled_, &given_enable_, &given_disable_, &given_plain_}) {
+      bits->resize(words, 0);
+    }
+  }
+
+  // Number of registered switches.
+  [[nodiscard]] std::size_t size() const noexcept { return names_.size(); }
+  [[nodiscard]] bool empty() const noexcept { return names_.empty(); }
+
+  [[nodiscard]] std::string_view name(const std::size_t bit) const { return names_[bit]; }
+
+  // Bit of the switch `name`, or npos when it is not registered.
+  [[nodiscard]] std::size_t index(const std::string_view name) const {
+    const auto it = ids_.find(name);
+    return it == ids_.end() ? npos : it->second;
+  }
+
+  // Whether switch `bit` is on after the last parse.
+  [[nodiscard]] bool test(const std::size_t bit) const { return test_(enabled_, bit); }
+
+  /**
+   * Mask over the switches in `names`, to pass to all(), any() or none().
+   *
+   * @throws std::invalid_argument if a name is not registered.
+   */
+  [[nodiscard]] std::vector<word_t> mask(std::initializer_list<std::string_view> names) const {
+    std::vector<word_t> words(enabled_.size(), 0);
+    for (const auto name : names) {
+      const auto bit = index(name);
+      if (bit == npos) {
+        throw std::invalid_argument(std::format("--{} is not a registered switch", name));
+      }
+      words[bit / 64] |= word_t{1} << (bit % 64);
+    }
+    return words;
+  }
+
+  // Every switch of `mask` is on.
+  [[nodiscard]] bool all(const std::span<const word_t> mask) const {
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+      if ((word_(i) & mask[i]) != mask[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // At least one switch of `mask` is on.
+  [[nodiscard]] bool any(const std::span<const word_t> mask) const {
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+      if ((word_(i) & mask[i]) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  [[nodiscard]] bool none(const std::span<const word_t> mask) const { return !any(mask); }
+
+  // Number of switches that are on.
+  [[nodiscard]] std::size_t count() const noexcept {
+    std::size_t total = 0;
+    for (const auto word : enabled_) {
+      total += static_cast<std::size_t>(std::popcount(word));
+    }
+    return total;
+  }
+
+  // Calls `fn(bit)` for every switch that is on, in bit order.
+  template <typename Fn> void for_each_enabled(Fn &&fn) const {
+    for (std::size_t i = 0; i < enabled_.size(); ++i) {
+      for (auto word = enabled_[i]; word != 0; word &= word - 1) {
+        fn(i * 64 + static_cast<std::size_t>(std::countr_zero(word)));
+      }
+    }
+  }
+
+  // The enabled bits, bit `b` in word b / 64; valid until the next parse.
+  [[nodiscard]] std::span<const word_t> words() const noexcept { return enabled_; }
+
+  // Copy of words(), for keeping past the next parse.
+  [[nodiscard]] std::vector<word_t> snapshot() const { return {enabled_.begin(), enabled_.end()}; }
+
+  /**
+   * Records the switch `key` (already stripped of its dashes). Returns false
+   * when `key` is not a registered switch.
+   *
+   * @throws args::error when `enable-X` and `disable-X` are both given.
+   */
+  bool set(const std::string_view key) {
+    const auto [kind, bit] = split_(key);
+    if (bit == npos) {
+      return false;
+    }
+
+    const auto word = bit / 64;
+    const auto flag = word_t{1} << (bit % 64);
+    if (kind == kind_t_::disable) {
+      if (given_enable_[word] & flag) {
+        throw_conflict_(bit);
+      }
+      given_disable_[word] |= flag;
+      enabled_[word] &= ~flag;
+      return true;
+    }
+
+    if (kind == kind_t_::enable) {
+      if (given_disable_[word] & flag) {
+        throw_conflict_(bit);
+      }
+      given_enable_[word] |= flag;
+    } else {
+      given_plain_[word] |= flag;
+    }
+    if (!(given_disable_[word] & flag)) {
+      enabled_[word] |= flag;
+    }
+    return true;
+  }
+
+  /**
+   * The value the switch form `key` would hold in the sequencer's storage:
+   * true for a given `enable-X` or `X`, false for a given `disable-X`, and
+   * std::nullopt when that form was not given or X is not registered.
+   */
+  [[nodiscard]] std::optional<bool> find(const std::string_view key) const {
+    if (names_.empty()) {
+      return std::nullopt;
+    }
+    const auto [kind, bit] = split_(key);
+    if (bit == npos) {
+      return std::nullopt;
+    }
+    switch (kind) {
+    case kind_t_::enable:
+      return test_(given_enable_, bit) ? std::optional(true) : std::nullopt;
+    case kind_t_::disable:
+      return test_(given_disable_, bit) ? std::optional(false) : std::nullopt;
+    default:
+      return test_(given_plain_, bit) ? std::optional(true) : std::nullopt;
+    }
+  }
+
+  // Turns every switch off, keeping the registered names.
+  void clear() noexcept {
+    for (auto *bits : {&enabled_, &given_enable_, &given_disable_, &given_plain_}) {
+      std::ranges::fill(*bits, 0);
+    }
+  }
+
+private:
+  enum class kind_t_ : std::uint8_t { plain, enable, disable };
+
+  std::pmr::vector<std::pmr::string> names_;
+  std::pmr::unordered_map<std::pmr::string, std::size_t, args_hash_t, std::equal_to<>> ids_;
+  std::pmr::vector<word_t> enabled_;
+  std::pmr::vector<word_t> given_enable_;
+  std::pmr::vector<word_t> given_disable_;
+  std::pmr::vector<word_t> given_plain_;
+
+  [[nodiscard]] static bool test_(const std::pmr::vector<word_t> &bits, const std::size_t bit) {
+    return (bits[bit / 64] >> (bit % 64)) & 1U;
+  }
+
+  [[nodiscard]] word_t word_(const std::size_t i) const {
+    return i < enabled_.size() ? enabled_[i] : 0;
+  }
+
+  [[nodiscard]] std::pair<kind_t_, std::size_t> split_(const std::string_view key) const {
+    if (key.starts_with("enable-")) {
+      return {kind_t_::enable, index(key.substr(7))};
+    }
+    if (key.starts_with("disable-")) {
+      return {kind_t_::disable, index(key.substr(8))};
+    }
+    return {kind_t_::plain, index(key)};
+  }
+
+  [[noreturn]] void throw_conflict_(const std::size_t bit) const {
+    throw error(std::make_tuple(std::format("--enable-{}", names_[bit]),
+                                std::format("--disable-{}", names_[bit])));
+  }
+};
+
+} // namespace nutsloop::args
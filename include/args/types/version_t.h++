@@ -1,6 +1,8 @@
 #pragma once
 #include <array>
+#include <cstddef>
 #include <optional>
+#include <string_view>
 
 namespace nutsloop::args {
 
@@ -8,4 +10,57 @@ namespace nutsloop::args {
 using version_t = std::array<int, 4>;
 using version_opt_t = std::optional<std::array<int, 4>>;
 
+/**
+ * Text of a version_t, formatted without allocating: "major.minor.patch",
+ * followed by "-suffix" when the suffix is not 0.
+ *
+ * @code
+ * constexpr version_string_t text(version_t{1, 4, 2, 0}); // text.view() == "1.4.2"
+ * @endcode
+ */
+class version_string_t {
+public:
+  constexpr version_string_t() noexcept = default;
+
+  constexpr explicit version_string_t(const version_t &version) noexcept {
+    for (std::size_t i = 0; i < 3; ++i) {
+      if (i != 0) {
+        chars_[size_++] = '.';
+      }
+      append_(version[i]);
+    }
+    if (version[3] != 0) {
+      chars_[size_++] = '-';
+      append_(version[3]);
+    }
+  }
+
+  [[nodiscard]] constexpr std::string_view view() const noexcept { return {chars_.data(), size_}; }
+
+private:
+  // four ints of up to 11 characters each and three separators.
+  std::array<char, 48> chars_{};
+  std::size_t size_{0};
+
+  constexpr void append_(const int part) noexcept {
+    const auto wide = static_cast<long long>(part);
+    auto magnitude = static_cast<unsigned long long>(wide < 0 ? -wide : wide);
+    if (wide < 0) {
+      chars_[size_++] = '-';
+    }
+    std::array<char, 20> digits{};
+    std::size_t count = 0;
+    do {
+      digits[count++] = static_cast<char>('0' + magnitude % 10);
+      magnitude /= 10;
+    } while (magnitude != 0);
+    while (count != 0) {
+      chars_[size_++] = digits[--count];
+    }
+  }
+};
+
+// Version text known at compile time: version_string_v<version_t{1, 4, 2, 0}>.view().
+template <version_t Version> inline constexpr version_string_t version_string_v{Version};
+
 } // namespace nutsloop::args
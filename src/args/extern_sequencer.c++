@@ -0,0 +1,10 @@
+#include "args/extern_sequencer.h++"
+
+// Definitions of the sequencers args/extern_sequencer.h++ declares extern.
+NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER(::nutsloop::args::args_key_value_t_);
+NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER(::nutsloop::args::args_key_value_t_, bool,
+                                    ::nutsloop::args::parse_sync_t, ::nutsloop::args::args_flat_t);
+NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER(::nutsloop::args::args_key_value_t_, bool,
+                                    ::nutsloop::args::parse_sync_t, ::nutsloop::args::pmr::args_t);
+NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER(::nutsloop::args::args_key_value_t_, bool,
+                                    ::nutsloop::args::parse_threaded_t);
@@ -0,0 +1,133 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+
+// Forwards to `upstream` and counts what passes through.
+class counting_resource final : public std::pmr::memory_resource {
+public:
+  explicit counting_resource(std::pmr::memory_resource *upstream) : upstream_(upstream) {}
+
+  std::size_t allocations{0};
+  std::size_t outstanding{0};
+
+private:
+  std::pmr::memory_resource *upstream_;
+
+  void *do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+    ++allocations;
+    outstanding += bytes;
+    return upstream_->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *p, const std::size_t bytes, const std::size_t alignment) override {
+    outstanding -= bytes;
+    upstream_->deallocate(p, bytes, alignment);
+  }
+
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// sequencer(std::allocator_arg, resource, ...)
+// ---------------------------------------------------------------------------
+
+void test_allocator_parse_state_comes_from_resource(void) {
+  counting_resource resource(std::pmr::new_delete_resource());
+  fake_argv fa{"prog", "serve", "--port=8080", "--include=a", "--include=b", "--verbose"};
+  {
+    seq_pmr_t seq(std::allocator_arg, &resource, fa.argc(), fa.argv(),
+                  std::unordered_set<std::string>{"port"});
+
+    TEST_ASSERT_TRUE(seq.resource() == &resource);
+    TEST_ASSERT_TRUE(resource.allocations > 0);
+    TEST_ASSERT_TRUE(seq.get_args().get_allocator().resource() == &resource);
+    TEST_ASSERT_EQUAL_STRING("8080", std::get<std::string>(seq.get_args().at("port")).c_str());
+    TEST_ASSERT_EQUAL_UINT64(2, seq.get_all<std::string>("include").size());
+    TEST_ASSERT_EQUAL_STRING("serve", seq.get_command().c_str());
+  }
+  // everything drawn from the resource is handed back with the sequencer.
+  TEST_ASSERT_EQUAL_UINT64(0, resource.outstanding);
+}
+
+void test_allocator_monotonic_arena(void) {
+  std::pmr::monotonic_buffer_resource arena(64 * 1024);
+  fake_argv fa{"prog", "--tags=x,y,z", "--timeout=30s", "--name=widget"};
+  seq_pmr_t seq(std::allocator_arg, &arena, fa.argc(), fa.argv(), std::nullopt, std::nullopt,
+                std::unordered_set<std::string>{"tags"}, std::nullopt,
+                std::unordered_set<std::string>{"timeout"});
+
+  const auto tags = seq.get_all<std::string>("tags");
+  TEST_ASSERT_EQUAL_UINT64(3, tags.size());
+  TEST_ASSERT_EQUAL_STRING("z", std::string(tags[2]).c_str());
+  TEST_ASSERT_TRUE(seq.get_arg<nutsloop::args::args_duration_t>("timeout") ==
+                   std::chrono::seconds(30));
+}
+
+void test_allocator_get_some_args_uses_resource(void) {
+  counting_resource resource(std::pmr::new_delete_resource());
+  fake_argv fa{"prog", "--a=1", "--b=2", "--c=3"};
+  seq_pmr_t seq(std::allocator_arg, &resource, fa.argc(), fa.argv());
+
+  const auto some = seq.get_some_args({"a", "c"});
+  TEST_ASSERT_EQUAL_UINT64(2, some.size());
+  TEST_ASSERT_TRUE(some.get_allocator().resource() == &resource);
+}
+
+void test_allocator_values_move_assign_across_resources(void) {
+  counting_resource first(std::pmr::new_delete_resource());
+  counting_resource second(std::pmr::new_delete_resource());
+  const auto filled = [](std::pmr::memory_resource *resource) {
+    nutsloop::args::args_values_t values(resource);
+    values.push("include", std::string_view("c"));
+    values.push("include", std::string_view("d"));
+    values.push("include", std::string_view("e"));
+    values.seal();
+    return values;
+  };
+  {
+    nutsloop::args::args_values_t values(&first);
+    values = filled(&second);
+
+    // the temporary's arena is gone; the views must point into the copy.
+    const auto include = values.values<std::string>("include");
+    TEST_ASSERT_EQUAL_UINT64(3, include.size());
+    TEST_ASSERT_EQUAL_STRING("c", std::string(include[0]).c_str());
+    TEST_ASSERT_EQUAL_STRING("e", std::string(include[2]).c_str());
+    TEST_ASSERT_EQUAL_UINT64(0, second.outstanding);
+  }
+  TEST_ASSERT_EQUAL_UINT64(0, first.outstanding);
+}
+
+void test_allocator_non_pmr_storage_still_parses(void) {
+  counting_resource resource(std::pmr::new_delete_resource());
+  fake_argv fa{"prog", "--port=8080", "--port=9090"};
+  seq_t seq(std::allocator_arg, &resource, fa.argc(), fa.argv());
+
+  // args_t is not allocator-aware; the value arena still uses the resource.
+  TEST_ASSERT_TRUE(resource.allocations > 0);
+  TEST_ASSERT_EQUAL_UINT64(9090, std::get<unsigned long long>(seq.get_args().at("port")));
+  TEST_ASSERT_EQUAL_UINT64(2, seq.get_all<unsigned long long>("port").size());
+}
+
+void test_allocator_default_constructor_uses_default_resource(void) {
+  fake_argv fa{"prog", "--verbose"};
+  seq_t seq(fa.argc(), fa.argv());
+  TEST_ASSERT_TRUE(seq.resource() == std::pmr::get_default_resource());
+}
@@ -0,0 +1,148 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include "args/batch.h++"
+
+#include <format>
+#include <span>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+
+namespace args = nutsloop::args;
+
+// Owns the argv of every line and hands them out as spans.
+struct fake_lines {
+  std::vector<std::vector<std::string>> storage;
+  std::vector<std::vector<const char *>> argvs;
+  std::vector<std::span<const char *const>> lines;
+
+  using input_t = std::vector<std::vector<std::string>>;
+
+  explicit fake_lines(input_t input) : storage(std::move(input)) {
+    for (auto &line : storage) {
+      auto &argv = argvs.emplace_back();
+      for (auto &arg : line) {
+        argv.push_back(arg.c_str());
+      }
+    }
+    for (auto &argv : argvs) {
+      lines.emplace_back(argv);
+    }
+  }
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// parse_batch<Sequencer>
+// ---------------------------------------------------------------------------
+
+void test_batch_columns_per_line(void) {
+  fake_lines fl({{"prog", "serve", "--port=8080", "--verbose"},
+                 {"prog", "--name=widget", "--timeout=2s"},
+                 {"prog"}});
+  const auto result = args::parse_batch<seq_t>(
+      fl.lines,
+      {.threads = 2, .chunk_size = 1, .typed_keys = std::unordered_set<std::string>{"timeout"}});
+
+  TEST_ASSERT_EQUAL_UINT64(3, result.size());
+  TEST_ASSERT_EQUAL_STRING("serve", std::string(result.command(0)).c_str());
+  TEST_ASSERT_EQUAL_UINT64(8080, result.get_arg<unsigned long long>(0, "port").value());
+  TEST_ASSERT_TRUE(result.get_arg<bool>(0, "verbose").value());
+  TEST_ASSERT_FALSE(result.get_arg<std::string>(0, "name").has_value());
+
+  TEST_ASSERT_TRUE(result.command(1).empty());
+  TEST_ASSERT_EQUAL_STRING("widget", result.get_arg<std::string>(1, "name")->c_str());
+  TEST_ASSERT_TRUE(result.get_arg<args::args_duration_t>(1, "timeout") == std::chrono::seconds(2));
+
+  TEST_ASSERT_EQUAL_UINT64(result.entry_begin(2), result.entry_end(2));
+  TEST_ASSERT_EQUAL_UINT64(0, result.error_count());
+}
+
+void test_batch_collects_errors_per_line(void) {
+  fake_lines fl({{"prog", "--ok=1"}, {"prog", "--x=1", "oops"}, {"prog", "--ok=2"},
+                 {"prog", "--value="}});
+  const auto result = args::parse_batch<seq_t>(fl.lines, {.threads = 3, .chunk_size = 1});
+
+  TEST_ASSERT_EQUAL_UINT64(2, result.error_count());
+  TEST_ASSERT_FALSE(result.failed(0));
+  TEST_ASSERT_TRUE(result.failed(1));
+  TEST_ASSERT_TRUE(result.error(1).find("--oops") != std::string_view::npos);
+  TEST_ASSERT_TRUE(result.error(0).empty());
+  TEST_ASSERT_TRUE(result.failed(3));
+  TEST_ASSERT_EQUAL_UINT64(2, result.get_arg<unsigned long long>(2, "ok").value());
+}
+
+void test_batch_interns_keys_once(void) {
+  std::vector<std::vector<std::string>> input;
+  for (int i = 0; i < 100; ++i) {
+    input.push_back({"prog", std::format("--id={}", i), "--region=eu", "--dry-run"});
+  }
+  fake_lines fl(std::move(input));
+  const auto result = args::parse_batch<seq_t>(fl.lines, {.threads = 4, .chunk_size = 7});
+
+  TEST_ASSERT_EQUAL_UINT64(3, result.keys().size());
+  const auto id = result.key_id("region");
+  TEST_ASSERT_TRUE(id != args::batch_result_t::npos);
+  for (std::size_t line = 0; line < result.size(); ++line) {
+    TEST_ASSERT_EQUAL_UINT64(3, result.entry_end(line) - result.entry_begin(line));
+    TEST_ASSERT_EQUAL_UINT64(line, result.get_arg<unsigned long long>(line, "id").value());
+    TEST_ASSERT_TRUE(result.get_arg<bool>(line, "dry-run").value());
+  }
+}
+
+void test_batch_same_result_for_any_thread_count(void) {
+  std::vector<std::vector<std::string>> input;
+  for (int i = 0; i < 500; ++i) {
+    input.push_back({"prog", i % 3 == 0 ? "build" : "test", std::format("--k{}={}", i % 11, i),
+                     i % 2 == 0 ? "--enable-cache" : "--disable-cache"});
+  }
+  fake_lines fl(std::move(input));
+  const auto one = args::parse_batch<seq_t>(fl.lines, {.threads = 1, .chunk_size = 16});
+  const auto many = args::parse_batch<seq_t>(fl.lines, {.threads = 8, .chunk_size = 3});
+
+  TEST_ASSERT_EQUAL_UINT64(one.keys().size(), many.keys().size());
+  for (std::size_t k = 0; k < one.keys().size(); ++k) {
+    TEST_ASSERT_EQUAL_STRING(one.keys()[k].c_str(), many.keys()[k].c_str());
+  }
+  for (std::size_t line = 0; line < one.size(); ++line) {
+    TEST_ASSERT_TRUE(one.command(line) == many.command(line));
+    TEST_ASSERT_EQUAL_UINT64(one.entry_begin(line), many.entry_begin(line));
+    for (auto entry = one.entry_begin(line); entry < one.entry_end(line); ++entry) {
+      TEST_ASSERT_EQUAL_UINT64(one.entry_key(entry), many.entry_key(entry));
+      TEST_ASSERT_TRUE(one.value(entry) == many.value(entry));
+    }
+  }
+}
+
+void test_batch_applies_sequencer_options(void) {
+  fake_lines fl(fake_lines::input_t{{"prog", "--code=007", "--tags=a,b"}});
+  const auto result = args::parse_batch<seq_t>(
+      fl.lines, {.skip_digit_check = std::unordered_set<std::string>{"code"},
+                 .list_keys = std::unordered_set<std::string>{"tags"}});
+
+  TEST_ASSERT_EQUAL_STRING("007", result.get_arg<std::string>(0, "code")->c_str());
+  TEST_ASSERT_EQUAL_STRING("a,b", result.get_arg<std::string>(0, "tags")->c_str());
+}
+
+void test_batch_get_arg_rejects_other_type(void) {
+  fake_lines fl(fake_lines::input_t{{"prog", "--port=8080"}});
+  const auto result = args::parse_batch<seq_t>(fl.lines);
+
+  bool threw = false;
+  try {
+    (void)result.get_arg<std::string>(0, "port");
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+}
@@ -0,0 +1,201 @@
+#include "args/checker_cache.h++"
+#include "test_types.h++"
+#include "unity.h"
+
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+using nutsloop::args::args_key_value_t_;
+using nutsloop::args::checker_cache;
+
+namespace {
+
+// Keeps a pointer to the value it was built from: built from the stored
+// value, it points into the sequencer's storage.
+struct ref_checker {
+  const args_key_value_t_ *value;
+  explicit ref_checker(const args_key_value_t_ &stored) : value(&stored) {}
+};
+
+// Validates `host:port` strings when built, counting how often it runs.
+struct addr_checker {
+  static inline int built = 0;
+  static inline int from_view = 0;
+
+  std::string host;
+  unsigned long long port{0};
+  bool present{false};
+
+  explicit addr_checker(const std::string_view text) : present(true) {
+    ++built;
+    ++from_view;
+    const auto colon = text.rfind(':');
+    if (colon == std::string_view::npos) {
+      throw std::invalid_argument(std::format("`{}` is not host:port", text));
+    }
+    host = text.substr(0, colon);
+    port = std::stoull(std::string(text.substr(colon + 1)));
+  }
+
+  explicit addr_checker(const args_key_value_t_ &value) {
+    ++built;
+    if (const auto *number = std::get_if<unsigned long long>(&value)) {
+      port = *number;
+      present = true;
+    } else if (const auto *flag = std::get_if<bool>(&value)) {
+      present = *flag;
+    }
+  }
+};
+
+static_assert(nutsloop::args::ArgsViewChecker<addr_checker>);
+static_assert(!nutsloop::args::ArgsViewChecker<test_checker>);
+
+using ref_seq_t = nutsloop::args::sequencer<ref_checker>;
+using addr_seq_t = nutsloop::args::sequencer<addr_checker>;
+
+void reset_counts() {
+  addr_checker::built = 0;
+  addr_checker::from_view = 0;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// get_option_* -- checkers built without copying
+// ---------------------------------------------------------------------------
+
+void test_getters_pass_stored_value_by_reference(void) {
+  fake_argv fa{"prog", "--name=a-value-longer-than-the-small-string-buffer", "--port=8080"};
+  ref_seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_TRUE(seq.get_option_string("name").value == &seq.get_args().at("name"));
+  TEST_ASSERT_TRUE(seq.get_option_addr("name").value == &seq.get_args().at("name"));
+  TEST_ASSERT_TRUE(seq.get_option_uint("port").value == &seq.get_args().at("port"));
+}
+
+void test_getters_pass_view_checker_a_string_view(void) {
+  fake_argv fa{"prog", "--bind-addr=10.0.0.1:8443", "--workers=4"};
+  addr_seq_t seq(fa.argc(), fa.argv());
+  reset_counts();
+
+  const auto bind = seq.get_option_addr("bind-addr");
+  TEST_ASSERT_EQUAL_STRING("10.0.0.1", bind.host.c_str());
+  TEST_ASSERT_EQUAL_UINT64(8443, bind.port);
+  TEST_ASSERT_EQUAL_INT(1, addr_checker::from_view);
+
+  TEST_ASSERT_EQUAL_UINT64(4, seq.get_option_uint("workers").port);
+  TEST_ASSERT_EQUAL_INT(1, addr_checker::from_view);
+  TEST_ASSERT_FALSE(seq.get_option_string("missing").present);
+}
+
+// ---------------------------------------------------------------------------
+// checker_cache
+// ---------------------------------------------------------------------------
+
+void test_cache_builds_each_checker_once(void) {
+  fake_argv fa{"prog", "--bind-addr=10.0.0.1:8443", "--workers=4"};
+  addr_seq_t seq(fa.argc(), fa.argv());
+  checker_cache checkers(seq);
+  reset_counts();
+
+  const addr_checker &bind = checkers.get("bind-addr");
+  for (int i = 0; i < 100; ++i) {
+    TEST_ASSERT_TRUE(&checkers.get("bind-addr") == &bind);
+  }
+  TEST_ASSERT_EQUAL_INT(1, addr_checker::built);
+  TEST_ASSERT_EQUAL_UINT64(8443, bind.port);
+
+  const addr_checker &absent = checkers.get("missing");
+  TEST_ASSERT_FALSE(absent.present);
+  TEST_ASSERT_TRUE(&checkers.get("other-missing") == &absent);
+  TEST_ASSERT_EQUAL_INT(2, addr_checker::built);
+  TEST_ASSERT_EQUAL_UINT64(1, checkers.size());
+}
+
+void test_cache_build_validates_everything_up_front(void) {
+  fake_argv fa{"prog", "--bind-addr=10.0.0.1:8443", "--workers=4", "--enable-tls", "--verbose"};
+  addr_seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt,
+                 std::vector<std::string>{"tls", "cache"});
+  checker_cache checkers(seq);
+  reset_counts();
+
+  checkers.build();
+  // three stored arguments, one given switch form and the absent checker.
+  TEST_ASSERT_EQUAL_INT(5, addr_checker::built);
+  TEST_ASSERT_EQUAL_UINT64(4, checkers.size());
+
+  TEST_ASSERT_TRUE(checkers.get("enable-tls").present);
+  TEST_ASSERT_TRUE(checkers.get("verbose").present);
+  TEST_ASSERT_EQUAL_UINT64(4, checkers.get("workers").port);
+  TEST_ASSERT_FALSE(checkers.get("enable-cache").present);
+  TEST_ASSERT_FALSE(checkers.get("missing").present);
+  TEST_ASSERT_EQUAL_INT(5, addr_checker::built);
+  TEST_ASSERT_EQUAL_UINT64(4, checkers.size());
+}
+
+void test_cache_lazily_answers_registered_switches(void) {
+  fake_argv fa{"prog", "--disable-tls"};
+  addr_seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt,
+                 std::vector<std::string>{"tls"});
+  checker_cache checkers(seq);
+
+  TEST_ASSERT_FALSE(checkers.get("disable-tls").present);
+  TEST_ASSERT_EQUAL_UINT64(1, checkers.size());
+  TEST_ASSERT_FALSE(checkers.get("enable-tls").present);
+  TEST_ASSERT_EQUAL_UINT64(1, checkers.size());
+}
+
+void test_cache_follows_reparse_after_build_or_clear(void) {
+  fake_argv first{"prog", "--bind-addr=10.0.0.1:8443"};
+  fake_argv second{"prog", "--bind-addr=10.0.0.2:9443"};
+  addr_seq_t seq(first.argc(), first.argv());
+  checker_cache checkers(seq);
+  TEST_ASSERT_EQUAL_UINT64(8443, checkers.get("bind-addr").port);
+
+  seq.parse(second.argc(), second.argv());
+  checkers.clear();
+  TEST_ASSERT_EQUAL_UINT64(0, checkers.size());
+  TEST_ASSERT_EQUAL_STRING("10.0.0.2", checkers.get("bind-addr").host.c_str());
+
+  seq.parse(first.argc(), first.argv());
+  checkers.build();
+  TEST_ASSERT_EQUAL_UINT64(8443, checkers.get("bind-addr").port);
+}
+
+void test_cache_does_not_keep_failed_checkers(void) {
+  fake_argv fa{"prog", "--bind-addr=localhost"};
+  addr_seq_t seq(fa.argc(), fa.argv());
+  checker_cache checkers(seq);
+  reset_counts();
+
+  for (int i = 0; i < 2; ++i) {
+    bool thrown = false;
+    try {
+      (void)checkers.get("bind-addr");
+    } catch (const std::invalid_argument &) {
+      thrown = true;
+    }
+    TEST_ASSERT_TRUE(thrown);
+  }
+  TEST_ASSERT_EQUAL_INT(2, addr_checker::built);
+  TEST_ASSERT_EQUAL_UINT64(0, checkers.size());
+
+  bool thrown = false;
+  try {
+    checkers.build();
+  } catch (const std::invalid_argument &) {
+    thrown = true;
+  }
+  TEST_ASSERT_TRUE(thrown);
+}
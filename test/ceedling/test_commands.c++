@@ -0,0 +1,136 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include "args/command_tree.h++"
+
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+
+namespace args = nutsloop::args;
+
+bool throws_invalid_argument(args::command_tree<seq_t> &tree, fake_argv &fa) {
+  try {
+    (void)tree.parse(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    return true;
+  }
+  return false;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// command_tree dispatch
+// ---------------------------------------------------------------------------
+
+void test_commands_dispatch_nested_path(void) {
+  args::command_tree<seq_t> tree;
+  tree.add("remote add").add("remote remove").add("build");
+
+  fake_argv fa{"prog", "remote", "add", "--name=origin", "--verbose"};
+  auto &seq = tree.parse(fa.argc(), fa.argv());
+  TEST_ASSERT_EQUAL_STRING("remote add", seq.get_command().c_str());
+  TEST_ASSERT_EQUAL_STRING("origin", seq.get_arg<std::string>("name")->c_str());
+  TEST_ASSERT_TRUE(seq.has("verbose"));
+  TEST_ASSERT_FALSE(seq.has("remote"));
+}
+
+void test_commands_build_only_selected_command(void) {
+  int built = 0;
+  args::command_tree<seq_t> tree;
+  for (int i = 0; i < 40; ++i) {
+    tree.add(std::format("command-{}", i), [&built] {
+      ++built;
+      return args::command_options_t{};
+    });
+  }
+
+  fake_argv first{"prog", "command-17", "--x=1"};
+  (void)tree.parse(first.argc(), first.argv());
+  TEST_ASSERT_EQUAL_INT(1, built);
+
+  // the same command reuses its sequencer.
+  fake_argv again{"prog", "command-17", "--x=2"};
+  auto &seq = tree.parse(again.argc(), again.argv());
+  TEST_ASSERT_EQUAL_INT(1, built);
+  TEST_ASSERT_EQUAL_UINT64(2, seq.get_arg<unsigned long long>("x").value());
+}
+
+void test_commands_apply_per_command_options(void) {
+  args::command_tree<seq_t> tree;
+  tree.add("tag", [] {
+    return args::command_options_t{.skip_digit_check = std::unordered_set<std::string>{"id"},
+                                   .list_keys = std::unordered_set<std::string>{"labels"}};
+  });
+  tree.add("show");
+
+  fake_argv tag{"prog", "tag", "--id=007", "--labels=a,b"};
+  auto &tagged = tree.parse(tag.argc(), tag.argv());
+  TEST_ASSERT_EQUAL_STRING("007", tagged.get_arg<std::string>("id")->c_str());
+  TEST_ASSERT_EQUAL_UINT64(2, tagged.get_all<std::string>("labels").size());
+
+  fake_argv show{"prog", "show", "--id=007"};
+  auto &shown = tree.parse(show.argc(), show.argv());
+  TEST_ASSERT_EQUAL_UINT64(7, shown.get_arg<unsigned long long>("id").value());
+}
+
+void test_commands_root_parses_argv_without_command(void) {
+  args::command_tree<seq_t> tree;
+  tree.add("build");
+
+  fake_argv fa{"prog", "--version"};
+  auto &seq = tree.parse(fa.argc(), fa.argv());
+  TEST_ASSERT_EQUAL_STRING("", seq.get_command().c_str());
+  TEST_ASSERT_TRUE(seq.has("version"));
+}
+
+void test_commands_reject_unknown_commands(void) {
+  args::command_tree<seq_t> tree;
+  tree.add("remote add").add("build");
+
+  fake_argv unknown{"prog", "deploy"};
+  TEST_ASSERT_TRUE(throws_invalid_argument(tree, unknown));
+
+  fake_argv unknown_child{"prog", "remote", "rename"};
+  TEST_ASSERT_TRUE(throws_invalid_argument(tree, unknown_child));
+
+  // a leaf hands the positional to its sequencer, which rejects it.
+  fake_argv positional{"prog", "build", "target"};
+  TEST_ASSERT_TRUE(throws_invalid_argument(tree, positional));
+
+  bool threw = false;
+  try {
+    tree.add("remote --bad");
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+}
+
+void test_commands_parse_command_on_sequencer(void) {
+  seq_t seq;
+  const char *argv[] = {"add", "origin-url", "--fetch"};
+  bool threw = false;
+  try {
+    seq.parse("remote add", std::span<const char *const>(argv));
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+
+  const char *flags[] = {"add", "--fetch"};
+  seq.parse("remote add", std::span<const char *const>(flags));
+  TEST_ASSERT_EQUAL_STRING("remote add", seq.get_command().c_str());
+  TEST_ASSERT_TRUE(seq.has("fetch"));
+}
@@ -0,0 +1,119 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <span>
+#include <stdexcept>
+#include <string>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+
+using nutsloop::args::early_exit_kind_t;
+
+std::span<const char *const> span_of(fake_argv &fa) {
+  return {fa.argv(), static_cast<std::size_t>(fa.argc())};
+}
+
+static_assert(nutsloop::args::version_string_v<nutsloop::args::version_t{1, 4, 2, 0}>.view() ==
+              "1.4.2");
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// version_string_t
+// ---------------------------------------------------------------------------
+
+void test_version_string_formats_parts(void) {
+  using nutsloop::args::version_string_t;
+  using nutsloop::args::version_t;
+
+  TEST_ASSERT_EQUAL_STRING("0.0.1",
+                           std::string(version_string_t(version_t{0, 0, 1, 0}).view()).c_str());
+  TEST_ASSERT_EQUAL_STRING("2.10.300-7",
+                           std::string(version_string_t(version_t{2, 10, 300, 7}).view()).c_str());
+  TEST_ASSERT_EQUAL_STRING(
+      "-1.2147483647.0--2147483648",
+      std::string(version_string_t(version_t{-1, 2147483647, 0, -2147483647 - 1}).view()).c_str());
+}
+
+void test_version_string_is_stored_by_version_request(void) {
+  fake_argv fa{"prog", "-v"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, nutsloop::args::version_t{3, 1, 4, 15});
+
+  TEST_ASSERT_EQUAL_STRING("3.1.4-15", std::string(seq.version_string()).c_str());
+  TEST_ASSERT_EQUAL_STRING("3.1.4-15", seq.get_arg<std::string>("version")->c_str());
+  TEST_ASSERT_EQUAL_UINT64(1, seq.get_args().size());
+}
+
+// ---------------------------------------------------------------------------
+// find_early_exit -- raw argv scan
+// ---------------------------------------------------------------------------
+
+void test_find_early_exit_reports_first_request(void) {
+  fake_argv fa{"prog", "build", "--port=80", "-?deploy", "--version"};
+  const auto request = nutsloop::args::find_early_exit(span_of(fa));
+
+  TEST_ASSERT_TRUE(request.has_value());
+  TEST_ASSERT_TRUE(request->kind == early_exit_kind_t::help);
+  TEST_ASSERT_EQUAL_STRING("deploy", std::string(request->topic).c_str());
+  TEST_ASSERT_EQUAL_UINT64(3, request->index);
+
+  fake_argv topics{"prog", "--help=serve", "--?", "--help", "--version"};
+  const auto all = span_of(topics);
+  const auto topic_at = [&all](const std::size_t skip) {
+    return std::string(nutsloop::args::find_early_exit(all.subspan(skip))->topic);
+  };
+  TEST_ASSERT_EQUAL_STRING("serve", topic_at(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("help", topic_at(1).c_str());
+  TEST_ASSERT_EQUAL_STRING("help", topic_at(2).c_str());
+  TEST_ASSERT_TRUE(nutsloop::args::find_early_exit(all.subspan(3))->kind ==
+                   early_exit_kind_t::version);
+}
+
+void test_find_early_exit_ignores_values_and_invalid_tokens(void) {
+  fake_argv fa{"prog", "help", "--name=--help", "--help=", "--v=1", "--versions", "-"};
+  TEST_ASSERT_FALSE(nutsloop::args::find_early_exit(span_of(fa)).has_value());
+}
+
+// ---------------------------------------------------------------------------
+// sequencer -- tokens around the request
+// ---------------------------------------------------------------------------
+
+void test_early_exit_still_checks_tokens_before_request(void) {
+  fake_argv fa{"prog", "--port=80", "stray", "--version"};
+  bool threw = false;
+  try {
+    seq_t seq(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+
+  fake_argv valid{"prog", "serve", "--port=80", "--help=serve", "--ignored="};
+  seq_t seq(valid.argc(), valid.argv());
+  TEST_ASSERT_EQUAL_STRING("serve", seq.get_command().c_str());
+  TEST_ASSERT_EQUAL_UINT64(80, *seq.get_arg<unsigned long long>("port"));
+  TEST_ASSERT_EQUAL_STRING("serve", seq.get_arg<std::string>("help")->c_str());
+  TEST_ASSERT_EQUAL_UINT64(2, seq.get_args().size());
+}
+
+void test_early_exit_threaded_probe_and_empty_key(void) {
+  fake_argv fa{"prog", "--version", "--ignored"};
+  seq_threaded_t seq(fa.argc(), fa.argv());
+  TEST_ASSERT_EQUAL_STRING("0.0.1", seq.get_arg<std::string>("version")->c_str());
+  TEST_ASSERT_FALSE(seq.has("ignored"));
+
+  fake_argv dashes{"prog", "--"};
+  bool threw = false;
+  try {
+    seq_t empty(dashes.argc(), dashes.argv());
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+}
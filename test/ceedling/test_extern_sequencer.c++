@@ -0,0 +1,64 @@
+#include "args/extern_sequencer.h++"
+#include "test_types.h++"
+#include "unity.h"
+
+#include <string>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+TEST_SOURCE_FILE("src/args/extern_sequencer.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace args = nutsloop::args;
+
+// a checker and helper pair instantiated by this test, as an application
+// would in one of its own translation units.
+NUTSLOOP_ARGS_EXTERN_SEQUENCER(test_checker, test_helper);
+NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER(test_checker, test_helper);
+
+// ---------------------------------------------------------------------------
+// sequencers compiled into args_lib
+// ---------------------------------------------------------------------------
+
+template <typename Sequencer> void check_parse() {
+  fake_argv fa{"prog", "serve", "--port=8080", "--name=widget", "--verbose"};
+  Sequencer seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("serve", seq.get_command().c_str());
+  TEST_ASSERT_EQUAL_UINT64(8080, seq.template get_arg<unsigned long long>("port").value());
+  TEST_ASSERT_EQUAL_STRING("widget", std::get<std::string>(seq.get_option_string("name")).c_str());
+  TEST_ASSERT_TRUE(std::get<bool>(seq.get_option_bool("verbose")));
+  TEST_ASSERT_FALSE(seq.has("missing"));
+}
+
+void test_library_sequencer_parses(void) {
+  check_parse<args::sequencer<args::args_key_value_t_>>();
+}
+
+void test_library_flat_sequencer_parses(void) {
+  check_parse<args::sequencer<args::args_key_value_t_, bool, args::parse_sync_t,
+                              args::args_flat_t>>();
+}
+
+void test_library_pmr_sequencer_parses(void) {
+  check_parse<args::sequencer<args::args_key_value_t_, bool, args::parse_sync_t,
+                              args::pmr::args_t>>();
+}
+
+void test_library_threaded_sequencer_parses(void) {
+  check_parse<args::sequencer<args::args_key_value_t_, bool, args::parse_threaded_t>>();
+}
+
+// ---------------------------------------------------------------------------
+// NUTSLOOP_ARGS_INSTANTIATE_SEQUENCER
+// ---------------------------------------------------------------------------
+
+void test_instantiated_pair_parses_and_helps(void) {
+  fake_argv fa{"prog", "--port=8080", "--help=port"};
+  seq_help_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_UINT64(8080, seq.get_arg<unsigned long long>("port").value());
+  TEST_ASSERT_EQUAL_STRING("port", seq.get_help("port").look_up.c_str());
+}
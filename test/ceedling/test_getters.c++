@@ -289,7 +289,7 @@ void test_get_help_constructs_helper(void) {
 }
 
 void test_get_help_passes_version(void) {
-  nutsloop::args::version_opt_t ver{std::array<int, 3>{3, 2, 1}};
+  nutsloop::args::version_opt_t ver{std::array<int, 4>{3, 2, 1, 0}};
   fake_argv fa{"prog", "--help"};
   seq_help_t seq(fa.argc(), fa.argv(), std::nullopt, ver);
 
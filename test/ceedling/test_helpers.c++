@@ -1,6 +1,12 @@
 #include "test_types.h++"
 #include "unity.h"
 
+#include <array>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <vector>
+
 TEST_SOURCE_FILE("src/args/args_stub.c++")
 TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
 
@@ -87,6 +93,84 @@ void test_join_skips_nullptr_entries(void) {
   TEST_ASSERT_EQUAL_STRING("a\nc", dest.c_str());
 }
 
+void test_join_reuses_dest_capacity(void) {
+  char *buf[] = {const_cast<char *>("x"), const_cast<char *>("y")};
+  std::string dest;
+  dest.reserve(64);
+  const auto *data = dest.data();
+  nutsloop::args::join(buf, 2, dest);
+  TEST_ASSERT_EQUAL_STRING("x\ny", dest.c_str());
+  TEST_ASSERT_TRUE(data == dest.data());
+}
+
+// ---------------------------------------------------------------------------
+// join() into a caller-provided span, and write_joined() to a file descriptor
+// ---------------------------------------------------------------------------
+
+void test_joined_size_skips_nullptr_entries(void) {
+  char *buf[] = {const_cast<char *>("ab"), nullptr, const_cast<char *>("cde")};
+  TEST_ASSERT_EQUAL_UINT64(6, nutsloop::args::joined_size(buf));
+  TEST_ASSERT_EQUAL_UINT64(0, nutsloop::args::joined_size({}));
+}
+
+void test_join_into_span(void) {
+  char *buf[] = {const_cast<char *>("a"), const_cast<char *>("bb"), const_cast<char *>("c")};
+  std::array<char, 8> dest{};
+  const auto size = nutsloop::args::join(buf, std::span<char>(dest), ',');
+  TEST_ASSERT_EQUAL_UINT64(6, size);
+  TEST_ASSERT_EQUAL_STRING("a,bb,c", dest.data());
+}
+
+void test_join_into_short_span_writes_nothing(void) {
+  char *buf[] = {const_cast<char *>("hello"), const_cast<char *>("world")};
+  std::array<char, 4> dest{};
+  const auto size = nutsloop::args::join(buf, std::span<char>(dest));
+  TEST_ASSERT_EQUAL_UINT64(11, size);
+  TEST_ASSERT_EQUAL_INT(0, dest[0]);
+}
+
+void test_argv_to_string_ranges_into_span(void) {
+  fake_argv fa{"prog", "--verbose", "--name=test"};
+  std::array<char, 32> dest{};
+  const auto size = seq_t::argv_to_string_ranges_(fa.argc(), fa.argv(), std::span<char>(dest));
+  TEST_ASSERT_EQUAL_STRING("--verbose|--name=test", std::string(dest.data(), size).c_str());
+}
+
+void test_write_joined_to_fd(void) {
+  char *buf[] = {const_cast<char *>("one"), nullptr, const_cast<char *>("two"),
+                 const_cast<char *>("three")};
+  std::FILE *file = std::tmpfile();
+  TEST_ASSERT_NOT_NULL(file);
+  TEST_ASSERT_TRUE(nutsloop::args::write_joined(fileno(file), buf, ' '));
+
+  std::rewind(file);
+  std::array<char, 32> contents{};
+  const auto size = std::fread(contents.data(), 1, contents.size(), file);
+  std::fclose(file);
+  TEST_ASSERT_EQUAL_STRING("one two three", std::string(contents.data(), size).c_str());
+}
+
+void test_write_joined_many_parts(void) {
+  // more parts than one writev() batch holds.
+  std::vector<std::string> parts(5000, "ab");
+  std::vector<char *> buf;
+  for (auto &part : parts) {
+    buf.push_back(part.data());
+  }
+  std::FILE *file = std::tmpfile();
+  TEST_ASSERT_NOT_NULL(file);
+  TEST_ASSERT_TRUE(nutsloop::args::write_joined(fileno(file), buf));
+
+  std::string expected(nutsloop::args::joined_size(buf), '\0');
+  nutsloop::args::join(buf, std::span<char>(expected));
+  std::rewind(file);
+  std::string contents(expected.size() + 1, '\0');
+  const auto size = std::fread(contents.data(), 1, contents.size(), file);
+  std::fclose(file);
+  contents.resize(size);
+  TEST_ASSERT_TRUE(expected == contents);
+}
+
 // ---------------------------------------------------------------------------
 // option_type_name_t -- compile-time type name resolution
 // ---------------------------------------------------------------------------
@@ -0,0 +1,144 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <chrono>
+#include <format>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+
+using nutsloop::args::parse_phase_t;
+using nutsloop::args::parse_stats_t;
+
+template <typename Sequencer>
+concept has_stats = requires(Sequencer &seq) {
+  seq.stats();
+  seq.on_parse({});
+};
+
+static_assert(has_stats<seq_stats_t>);
+static_assert(!has_stats<seq_t>);
+
+struct many_keys_t {
+  std::vector<std::string> storage{"prog"};
+  std::vector<const char *> ptrs;
+
+  explicit many_keys_t(const int count) {
+    for (int i = 0; i < count; ++i) {
+      storage.push_back(std::format("--key-{}=value", i));
+    }
+    for (const auto &arg : storage) {
+      ptrs.push_back(arg.c_str());
+    }
+  }
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// instrumented_t -- counts
+// ---------------------------------------------------------------------------
+
+void test_stats_count_arguments_by_kind(void) {
+  fake_argv fa{"prog",    "build",        "--enable-cache", "--disable-color", "--verbose",
+               "--jit",   "--name=widget", "--port=8080",   "--ratio=0.5",     "--tags=a,b,c"};
+  seq_stats_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt,
+                  std::unordered_set<std::string>{"tags"}, std::vector<std::string>{"jit"},
+                  std::unordered_set<std::string>{"ratio"});
+  const parse_stats_t &stats = seq.stats();
+
+  TEST_ASSERT_EQUAL_UINT64(1, stats.enable_switches);
+  TEST_ASSERT_EQUAL_UINT64(1, stats.disable_switches);
+  TEST_ASSERT_EQUAL_UINT64(1, stats.truthy_switches);
+  TEST_ASSERT_EQUAL_UINT64(1, stats.registered_switches);
+  TEST_ASSERT_EQUAL_UINT64(1, stats.string_values);
+  TEST_ASSERT_EQUAL_UINT64(2, stats.numeric_values);
+  TEST_ASSERT_EQUAL_UINT64(1, stats.list_values);
+  TEST_ASSERT_EQUAL_UINT64(0, stats.response_files);
+}
+
+void test_stats_count_allocations_from_resource(void) {
+  fake_argv fa{"prog", "--name=a-value-longer-than-the-small-string-buffer", "--port=8080"};
+  seq_stats_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_TRUE(seq.stats().allocations > 0);
+  TEST_ASSERT_TRUE(seq.stats().allocated_bytes >= seq.stats().allocations);
+  TEST_ASSERT_TRUE(seq.resource() != std::pmr::get_default_resource());
+}
+
+void test_stats_count_rehashes_of_growing_storage(void) {
+  seq_stats_t seq;
+  many_keys_t many(200);
+  seq.parse(many.ptrs);
+  TEST_ASSERT_EQUAL_UINT64(200, seq.stats().string_values);
+  TEST_ASSERT_TRUE(seq.stats().rehashes > 0);
+
+  // reset() keeps the buckets, so the same command line fits without growing.
+  seq.parse(many.ptrs);
+  TEST_ASSERT_EQUAL_UINT64(0, seq.stats().rehashes);
+}
+
+// ---------------------------------------------------------------------------
+// instrumented_t -- timings and the callback
+// ---------------------------------------------------------------------------
+
+void test_stats_phases_fit_in_total(void) {
+  many_keys_t many(64);
+  seq_stats_t seq;
+  seq.parse(many.ptrs);
+  const auto &stats = seq.stats();
+
+  std::chrono::nanoseconds phases{0};
+  for (const auto phase : stats.phases) {
+    phases += phase;
+  }
+  TEST_ASSERT_TRUE(stats.total > std::chrono::nanoseconds{0});
+  TEST_ASSERT_TRUE(phases <= stats.total);
+  TEST_ASSERT_TRUE(stats.phase(parse_phase_t::store) > std::chrono::nanoseconds{0});
+}
+
+void test_stats_callback_runs_after_each_parse(void) {
+  seq_stats_t seq;
+  std::vector<parse_stats_t> reports;
+  seq.on_parse([&reports](const parse_stats_t &stats) { reports.push_back(stats); });
+
+  fake_argv first{"prog", "--verbose", "--port=80"};
+  seq.parse(first.argc(), first.argv());
+  fake_argv second{"prog", "--version", "--ignored"};
+  seq.parse(second.argc(), second.argv());
+
+  TEST_ASSERT_EQUAL_UINT64(2, reports.size());
+  TEST_ASSERT_EQUAL_UINT64(1, reports[0].truthy_switches);
+  TEST_ASSERT_EQUAL_UINT64(1, reports[0].numeric_values);
+  TEST_ASSERT_EQUAL_UINT64(0, reports[1].truthy_switches);
+  TEST_ASSERT_TRUE(seq.has("version"));
+}
+
+void test_stats_not_updated_by_failed_parse(void) {
+  seq_stats_t seq;
+  int reports = 0;
+  seq.on_parse([&reports](const parse_stats_t &) { ++reports; });
+
+  fake_argv good{"prog", "--verbose"};
+  seq.parse(good.argc(), good.argv());
+
+  fake_argv bad{"prog", "--port=80", "stray"};
+  bool threw = false;
+  try {
+    seq.parse(bad.argc(), bad.argv());
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+  TEST_ASSERT_EQUAL_INT(1, reports);
+  TEST_ASSERT_EQUAL_UINT64(1, seq.stats().truthy_switches);
+  TEST_ASSERT_EQUAL_UINT64(0, seq.stats().numeric_values);
+}
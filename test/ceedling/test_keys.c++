@@ -0,0 +1,100 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ---------------------------------------------------------------------------
+// string_view lookups
+// ---------------------------------------------------------------------------
+
+void test_getters_accept_string_view(void) {
+  fake_argv fa{"prog", "--host=example.org", "--port=8080", "--verbose"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  constexpr std::string_view host = "host";
+  TEST_ASSERT_TRUE(seq.has(host));
+  TEST_ASSERT_EQUAL_STRING("example.org", seq.get_arg<std::string>(host)->c_str());
+  TEST_ASSERT_EQUAL_UINT64(8080, seq.get_arg<unsigned long long>(std::string_view("port")).value());
+  TEST_ASSERT_TRUE(std::get<bool>(seq.get_option_bool(std::string_view("verbose")).value));
+  TEST_ASSERT_TRUE(seq.get_args().contains(host));
+}
+
+// ---------------------------------------------------------------------------
+// key() handles
+// ---------------------------------------------------------------------------
+
+void test_key_returns_same_handle_for_same_name(void) {
+  seq_t seq;
+  const auto threads = seq.key("threads");
+  TEST_ASSERT_TRUE(threads == seq.key(std::string("threads")));
+  TEST_ASSERT_FALSE(threads == seq.key("verbose"));
+}
+
+void test_key_lookups_follow_each_parse(void) {
+  seq_flat_t seq;
+  const auto threads = seq.key("threads");
+  const auto verbose = seq.key("verbose");
+
+  fake_argv first{"prog", "--threads=8", "--verbose"};
+  seq.parse(first.argc(), first.argv());
+  TEST_ASSERT_EQUAL_UINT64(8, seq.get_arg<unsigned long long>(threads).value());
+  TEST_ASSERT_TRUE(seq.has(verbose));
+
+  fake_argv second{"prog", "--threads=2"};
+  seq.parse(second.argc(), second.argv());
+  TEST_ASSERT_EQUAL_UINT64(2, seq.get_arg<unsigned long long>(threads).value());
+  TEST_ASSERT_FALSE(seq.has(verbose));
+  TEST_ASSERT_FALSE(seq.get_arg<bool>(verbose).has_value());
+
+  seq.reset();
+  TEST_ASSERT_FALSE(seq.has(threads));
+}
+
+void test_key_interned_after_parse(void) {
+  fake_argv fa{"prog", "--region=eu"};
+  seq_t seq(fa.argc(), fa.argv());
+  const auto region = seq.key("region");
+  TEST_ASSERT_EQUAL_STRING("eu", seq.get_arg<std::string>(region)->c_str());
+}
+
+void test_key_survives_copy(void) {
+  fake_argv fa{"prog", "--replicas=3"};
+  seq_pmr_t seq(fa.argc(), fa.argv());
+  const auto replicas = seq.key("replicas");
+
+  const seq_pmr_t copy = seq;
+  seq.reset();
+  TEST_ASSERT_FALSE(seq.has(replicas));
+  TEST_ASSERT_EQUAL_UINT64(3, copy.get_arg<unsigned long long>(replicas).value());
+}
+
+void test_key_wrong_type_or_foreign_handle_throws(void) {
+  fake_argv fa{"prog", "--port=8080"};
+  seq_t seq(fa.argc(), fa.argv());
+  const auto port = seq.key("port");
+
+  bool threw = false;
+  try {
+    (void)seq.get_arg<std::string>(port);
+  } catch (const std::invalid_argument &e) {
+    threw = std::string(e.what()).find("--port") != std::string::npos;
+  }
+  TEST_ASSERT_TRUE(threw);
+
+  seq_t other;
+  threw = false;
+  try {
+    (void)other.has(port);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+}
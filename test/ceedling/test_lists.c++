@@ -0,0 +1,121 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <format>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ---------------------------------------------------------------------------
+// get_all -- repeated options
+// ---------------------------------------------------------------------------
+
+void test_repeated_option_keeps_every_value_in_order(void) {
+  fake_argv fa{"prog", "--include=a", "--verbose", "--include=b", "--include=c"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  const auto includes = seq.get_all<std::string>("include");
+  TEST_ASSERT_EQUAL_UINT(3, includes.size());
+  TEST_ASSERT_TRUE(includes[0] == "a");
+  TEST_ASSERT_TRUE(includes[1] == "b");
+  TEST_ASSERT_TRUE(includes[2] == "c");
+
+  // the map still holds the last value.
+  TEST_ASSERT_EQUAL_STRING("c", seq.get_arg<std::string>("include")->c_str());
+}
+
+void test_repeated_numbers_and_switches(void) {
+  fake_argv fa{"prog", "--port=80", "-q", "--port=443", "-q"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  const auto ports = seq.get_all<unsigned long long>("port");
+  TEST_ASSERT_EQUAL_UINT(2, ports.size());
+  TEST_ASSERT_EQUAL_UINT64(80, ports[0]);
+  TEST_ASSERT_EQUAL_UINT64(443, ports[1]);
+  TEST_ASSERT_EQUAL_UINT(2, seq.get_all<bool>("q").size());
+}
+
+void test_get_all_missing_key_is_empty(void) {
+  fake_argv fa{"prog", "--a=1"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_TRUE(seq.get_all<std::string>("missing").empty());
+}
+
+void test_get_all_mixed_types_read_as_strings(void) {
+  fake_argv fa{"prog", "--level=3", "--level=high", "--tags=prod,2024", "-q", "--q=x"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt,
+            std::unordered_set<std::string>{"tags"});
+
+  const auto levels = seq.get_all<std::string>("level");
+  TEST_ASSERT_EQUAL_UINT(2, levels.size());
+  TEST_ASSERT_EQUAL_STRING("3", std::string(levels[0]).c_str());
+  TEST_ASSERT_EQUAL_STRING("high", std::string(levels[1]).c_str());
+
+  const auto tags = seq.get_all<std::string>("tags");
+  TEST_ASSERT_EQUAL_UINT(2, tags.size());
+  TEST_ASSERT_EQUAL_STRING("prod", std::string(tags[0]).c_str());
+  TEST_ASSERT_EQUAL_STRING("2024", std::string(tags[1]).c_str());
+
+  const auto q = seq.get_all<std::string>("q");
+  TEST_ASSERT_EQUAL_UINT(2, q.size());
+  TEST_ASSERT_EQUAL_STRING("true", std::string(q[0]).c_str());
+
+  // a typed read still needs every value to have that type.
+  bool caught = false;
+  try {
+    (void)seq.get_all<unsigned long long>("tags");
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for mixed value types");
+}
+
+// ---------------------------------------------------------------------------
+// get_all -- comma-separated list keys
+// ---------------------------------------------------------------------------
+
+void test_list_key_is_split_on_commas(void) {
+  fake_argv fa{"prog", "--tags=a,b,c", "--tags=d"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt,
+            std::unordered_set<std::string>{"tags"});
+
+  const auto tags = seq.get_all<std::string>("tags");
+  TEST_ASSERT_EQUAL_UINT(4, tags.size());
+  TEST_ASSERT_TRUE(tags[0] == "a");
+  TEST_ASSERT_TRUE(tags[2] == "c");
+  TEST_ASSERT_TRUE(tags[3] == "d");
+  TEST_ASSERT_EQUAL_STRING("d", seq.get_arg<std::string>("tags")->c_str());
+}
+
+void test_list_elements_get_number_detection(void) {
+  fake_argv fa{"prog", "--ids=1,2,3", "--names=1,2"};
+  seq_t seq(fa.argc(), fa.argv(), std::unordered_set<std::string>{"names"}, std::nullopt,
+            std::unordered_set<std::string>{"ids", "names"});
+
+  const auto ids = seq.get_all<unsigned long long>("ids");
+  TEST_ASSERT_EQUAL_UINT(3, ids.size());
+  TEST_ASSERT_EQUAL_UINT64(3, ids[2]);
+  TEST_ASSERT_EQUAL_UINT(2, seq.get_all<std::string>("names").size());
+  // the unsplit value is kept in the map.
+  TEST_ASSERT_EQUAL_STRING("1,2,3", seq.get_arg<std::string>("ids")->c_str());
+}
+
+void test_list_values_survive_copy_and_large_lists(void) {
+  std::string list = "--items=item-0";
+  for (int i = 1; i < 10000; ++i) {
+    list += std::format(",item-{}", i);
+  }
+  fake_argv fa{"prog", list.c_str()};
+  const seq_flat_t original(fa.argc(), fa.argv(), std::nullopt, std::nullopt,
+                            std::unordered_set<std::string>{"items"});
+  const seq_flat_t copy = original;
+
+  const auto items = copy.get_all<std::string>("items");
+  TEST_ASSERT_EQUAL_UINT(10000, items.size());
+  TEST_ASSERT_TRUE(items[0] == "item-0");
+  TEST_ASSERT_TRUE(items[9999] == "item-9999");
+}
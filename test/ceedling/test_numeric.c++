@@ -0,0 +1,70 @@
+#include "test_types.h++"
+#include "unity.h"
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+using nutsloop::args::detail::parse_ull_;
+
+// ---------------------------------------------------------------------------
+// parse_ull_ -- single-pass classification and conversion
+// ---------------------------------------------------------------------------
+
+void test_parse_ull_every_length(void) {
+  std::string digits;
+  unsigned long long expected = 0;
+  for (int length = 1; length <= 19; ++length) {
+    const int digit = length % 10;
+    digits += static_cast<char>('0' + digit);
+    expected = expected * 10 + static_cast<unsigned long long>(digit);
+
+    const auto number = parse_ull_(digits);
+    TEST_ASSERT_TRUE(number.has_value());
+    TEST_ASSERT_EQUAL_UINT64(expected, *number);
+  }
+}
+
+void test_parse_ull_range_boundary(void) {
+  TEST_ASSERT_EQUAL_UINT64(18446744073709551615ULL, *parse_ull_("18446744073709551615"));
+  TEST_ASSERT_EQUAL_UINT64(10000000000000000000ULL, *parse_ull_("10000000000000000000"));
+  TEST_ASSERT_FALSE(parse_ull_("18446744073709551616").has_value());
+  TEST_ASSERT_FALSE(parse_ull_("99999999999999999999").has_value());
+  TEST_ASSERT_FALSE(parse_ull_("100000000000000000000").has_value());
+}
+
+void test_parse_ull_rejects_non_digits_in_every_position(void) {
+  for (std::size_t position = 0; position < 20; ++position) {
+    std::string value(20, '1');
+    value[position] = position % 2 == 0 ? '/' : ':'; // neighbours of '0' and '9'
+    TEST_ASSERT_FALSE(parse_ull_(value).has_value());
+  }
+  TEST_ASSERT_FALSE(parse_ull_("").has_value());
+  TEST_ASSERT_FALSE(parse_ull_("-1").has_value());
+  TEST_ASSERT_FALSE(parse_ull_("+1").has_value());
+  TEST_ASSERT_FALSE(parse_ull_("1.5").has_value());
+  TEST_ASSERT_FALSE(parse_ull_("12345678 ").has_value());
+  TEST_ASSERT_FALSE(parse_ull_("\xB1\x32\x33\x34\x35\x36\x37\x38").has_value());
+}
+
+void test_parse_ull_leading_zeros(void) {
+  TEST_ASSERT_EQUAL_UINT64(7, *parse_ull_("00000007"));
+  TEST_ASSERT_EQUAL_UINT64(0, *parse_ull_("00000000000000000000"));
+  // more digits than ULLONG_MAX has stays a string, as before.
+  TEST_ASSERT_FALSE(parse_ull_("000000000000000000001").has_value());
+}
+
+// ---------------------------------------------------------------------------
+// sequencer -- numeric detection goes through parse_ull_
+// ---------------------------------------------------------------------------
+
+void test_long_numeric_values_are_detected(void) {
+  fake_argv fa{"prog", "--shard-0=1234567890123", "--id=12345678x", "--port=8"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_UINT64(1234567890123ULL, *seq.get_arg<unsigned long long>("shard-0"));
+  TEST_ASSERT_EQUAL_STRING("12345678x", seq.get_arg<std::string>("id")->c_str());
+  TEST_ASSERT_EQUAL_UINT64(8, *seq.get_arg<unsigned long long>("port"));
+}
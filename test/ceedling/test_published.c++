@@ -0,0 +1,166 @@
+#include "args/published.h++"
+#include "test_types.h++"
+#include "unity.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+using nutsloop::args::published_t;
+using nutsloop::args::snapshot_t;
+
+namespace {
+
+// Counts live values, so tests can tell when a replaced one is freed.
+struct tracked_t {
+  static inline std::atomic<int> live{0};
+
+  std::uint64_t first;
+  std::uint64_t second;
+
+  explicit tracked_t(const std::uint64_t value) : first(value), second(value) { ++live; }
+  tracked_t(const tracked_t &) = delete;
+  ~tracked_t() { --live; }
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// published_t -- publish and read
+// ---------------------------------------------------------------------------
+
+void test_published_reader_before_publish_sees_nothing(void) {
+  published_t<tracked_t> holder;
+  auto reader = holder.reader();
+
+  TEST_ASSERT_TRUE(reader.get() == nullptr);
+  TEST_ASSERT_EQUAL_UINT64(0, reader.generation());
+  TEST_ASSERT_EQUAL_UINT64(0, holder.generation());
+}
+
+void test_published_readers_follow_publish(void) {
+  published_t<tracked_t> holder(std::make_unique<const tracked_t>(1));
+  auto reader = holder.reader();
+
+  TEST_ASSERT_EQUAL_UINT64(1, reader->first);
+  TEST_ASSERT_EQUAL_UINT64(1, reader.generation());
+
+  TEST_ASSERT_EQUAL_UINT64(2, holder.emplace(2));
+  TEST_ASSERT_EQUAL_UINT64(1, reader.generation());
+  TEST_ASSERT_EQUAL_UINT64(2, (*reader).first);
+  TEST_ASSERT_EQUAL_UINT64(2, reader.generation());
+  TEST_ASSERT_EQUAL_UINT64(2, holder.generation());
+}
+
+void test_published_keeps_replaced_value_until_readers_move_on(void) {
+  tracked_t::live = 0;
+  {
+    published_t<tracked_t> holder;
+    holder.emplace(1);
+    auto reader = holder.reader();
+    const tracked_t *held = reader.get();
+
+    holder.emplace(2);
+    TEST_ASSERT_EQUAL_INT(2, tracked_t::live.load());
+    TEST_ASSERT_EQUAL_UINT64(1, held->first);
+    TEST_ASSERT_EQUAL_UINT64(1, holder.reclaim());
+
+    TEST_ASSERT_EQUAL_UINT64(2, reader->first);
+    TEST_ASSERT_EQUAL_UINT64(0, holder.reclaim());
+    TEST_ASSERT_EQUAL_INT(1, tracked_t::live.load());
+
+    // a value nobody read is freed by the publish that replaces it.
+    holder.emplace(3);
+    holder.emplace(4);
+    TEST_ASSERT_EQUAL_INT(2, tracked_t::live.load());
+  }
+  TEST_ASSERT_EQUAL_INT(0, tracked_t::live.load());
+}
+
+void test_published_destroyed_reader_releases_its_value(void) {
+  tracked_t::live = 0;
+  published_t<tracked_t> holder;
+  holder.emplace(1);
+  {
+    auto reader = holder.reader();
+    TEST_ASSERT_EQUAL_UINT64(1, reader->first);
+    auto moved = std::move(reader);
+    holder.emplace(2);
+    TEST_ASSERT_EQUAL_UINT64(1, holder.reclaim());
+  }
+  TEST_ASSERT_EQUAL_UINT64(0, holder.reclaim());
+  TEST_ASSERT_EQUAL_INT(1, tracked_t::live.load());
+
+  auto reader = holder.reader();
+  TEST_ASSERT_EQUAL_UINT64(2, reader->second);
+}
+
+void test_published_concurrent_reads_during_reloads(void) {
+  tracked_t::live = 0;
+  constexpr std::uint64_t reloads = 2000;
+  {
+    published_t<tracked_t> holder;
+    holder.emplace(0);
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+      readers.emplace_back([&] {
+        auto reader = holder.reader();
+        std::uint64_t last = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+          const tracked_t &value = *reader;
+          if (value.first != value.second || value.first < last) {
+            ++torn;
+          }
+          last = value.first;
+        }
+      });
+    }
+    for (std::uint64_t i = 1; i <= reloads; ++i) {
+      holder.emplace(i);
+    }
+    done = true;
+    for (auto &thread : readers) {
+      thread.join();
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, torn.load());
+    TEST_ASSERT_EQUAL_UINT64(reloads + 1, holder.generation());
+    TEST_ASSERT_EQUAL_UINT64(0, holder.reclaim());
+    TEST_ASSERT_EQUAL_INT(1, tracked_t::live.load());
+  }
+  TEST_ASSERT_EQUAL_INT(0, tracked_t::live.load());
+}
+
+// ---------------------------------------------------------------------------
+// published_t<snapshot_t>
+// ---------------------------------------------------------------------------
+
+void test_published_snapshot_hot_reload(void) {
+  fake_argv first{"prog", "serve", "--threads=8", "--host=alpha"};
+  fake_argv second{"prog", "serve", "--threads=16", "--host=beta"};
+  seq_t parser(first.argc(), first.argv());
+
+  published_t<snapshot_t> config;
+  config.emplace(parser.snapshot());
+  auto reader = config.reader();
+  TEST_ASSERT_EQUAL_UINT64(8, *reader->get_arg<unsigned long long>("threads"));
+  TEST_ASSERT_TRUE(reader->get_view("host") == "alpha");
+
+  parser.parse(second.argc(), second.argv());
+  config.emplace(parser.snapshot());
+  TEST_ASSERT_EQUAL_UINT64(16, *reader->get_arg<unsigned long long>("threads"));
+  TEST_ASSERT_TRUE(reader->get_view("host") == "beta");
+  TEST_ASSERT_EQUAL_STRING("serve", std::string(reader->get_command()).c_str());
+}
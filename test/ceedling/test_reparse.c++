@@ -0,0 +1,100 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <span>
+#include <string>
+#include <unordered_set>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ---------------------------------------------------------------------------
+// parse() and reset()
+// ---------------------------------------------------------------------------
+
+void test_reparse_replaces_previous_result(void) {
+  seq_t seq;
+  fake_argv first{"prog", "serve", "--port=8080", "--verbose"};
+  seq.parse(first.argc(), first.argv());
+  TEST_ASSERT_EQUAL_STRING("serve", seq.get_command().c_str());
+  TEST_ASSERT_TRUE(seq.has("verbose"));
+
+  fake_argv second{"prog", "--host=example.org"};
+  seq.parse(second.argc(), second.argv());
+  TEST_ASSERT_EQUAL_STRING("", seq.get_command().c_str());
+  TEST_ASSERT_FALSE(seq.has("verbose"));
+  TEST_ASSERT_FALSE(seq.has("port"));
+  TEST_ASSERT_EQUAL_STRING("example.org",
+                           std::get<std::string>(seq.get_args().at("host")).c_str());
+}
+
+void test_reparse_accepts_span_of_const_char(void) {
+  seq_flat_t seq;
+  const char *argv[] = {"prog", "deploy", "--replicas=3"};
+  seq.parse(std::span<const char *const>(argv));
+  TEST_ASSERT_EQUAL_STRING("deploy", seq.get_command().c_str());
+  TEST_ASSERT_EQUAL_UINT64(3, seq.get_arg<unsigned long long>("replicas").value());
+}
+
+void test_reparse_empty_argv_leaves_sequencer_empty(void) {
+  seq_t seq;
+  fake_argv first{"prog", "--verbose"};
+  seq.parse(first.argc(), first.argv());
+
+  fake_argv empty{"prog"};
+  seq.parse(empty.argc(), empty.argv());
+  TEST_ASSERT_EQUAL_UINT64(0, seq.get_args().size());
+  TEST_ASSERT_EQUAL_UINT64(0, seq.get_all<bool>("verbose").size());
+}
+
+void test_reparse_clears_help_and_version_requests(void) {
+  seq_t seq;
+  fake_argv help{"prog", "--help", "--ignored"};
+  seq.parse(help.argc(), help.argv());
+  TEST_ASSERT_TRUE(seq.has("help"));
+
+  fake_argv plain{"prog", "--ignored"};
+  seq.parse(plain.argc(), plain.argv());
+  TEST_ASSERT_FALSE(seq.has("help"));
+  TEST_ASSERT_TRUE(seq.has("ignored"));
+}
+
+void test_reparse_keeps_configuration(void) {
+  seq_t seq(std::unordered_set<std::string>{"code"}, std::nullopt,
+            std::unordered_set<std::string>{"tags"});
+  for (int run = 0; run < 3; ++run) {
+    fake_argv fa{"prog", "--code=007", "--tags=a,b", "--tags=c"};
+    seq.parse(fa.argc(), fa.argv());
+    TEST_ASSERT_EQUAL_STRING("007", std::get<std::string>(seq.get_args().at("code")).c_str());
+    TEST_ASSERT_EQUAL_UINT64(3, seq.get_all<std::string>("tags").size());
+  }
+}
+
+void test_reparse_threaded_policy(void) {
+  seq_threaded_t seq;
+  fake_argv first{"prog", "--a=1"};
+  seq.parse(first.argc(), first.argv());
+  fake_argv second{"prog", "--b=2"};
+  seq.parse(second.argc(), second.argv());
+  TEST_ASSERT_FALSE(seq.has("a"));
+  TEST_ASSERT_EQUAL_UINT64(2, std::get<unsigned long long>(seq.get_args().at("b")));
+}
+
+void test_reset_after_failed_parse(void) {
+  seq_t seq;
+  fake_argv bad{"prog", "--good=1", "bad"};
+  bool threw = false;
+  try {
+    seq.parse(bad.argc(), bad.argv());
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+
+  seq.reset();
+  TEST_ASSERT_EQUAL_UINT64(0, seq.get_args().size());
+  TEST_ASSERT_EQUAL_STRING("", seq.get_command().c_str());
+}
@@ -0,0 +1,189 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include "args/resolver.h++"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+using nutsloop::args::resolver;
+using nutsloop::args::resolver_layer_t;
+
+namespace {
+
+std::filesystem::path scratch_dir;
+
+std::string write_config(const std::string &contents) {
+  const auto path = scratch_dir / "app.conf";
+  std::ofstream(path, std::ios::binary) << contents;
+  return path.string();
+}
+
+} // namespace
+
+void setUp(void) {
+  scratch_dir = std::filesystem::temp_directory_path() / "nutsloop_args_resolver";
+  std::filesystem::create_directories(scratch_dir);
+}
+
+void tearDown(void) {
+  for (const char *name : {"RT_THREADS", "RT_MAX_THREADS", "RT_VERBOSE", "RT_DISABLE_CACHE",
+                           "RT_TIMEOUT", "RT_ZIP"}) {
+    ::unsetenv(name);
+  }
+  std::filesystem::remove_all(scratch_dir);
+}
+
+// ---------------------------------------------------------------------------
+// resolver -- layer order
+// ---------------------------------------------------------------------------
+
+void test_argv_wins_over_environment_and_config(void) {
+  ::setenv("RT_THREADS", "16", 1);
+  const auto config = write_config("threads=8\n");
+  fake_argv fa{"prog", "--threads=32"};
+  seq_t seq(fa.argc(), fa.argv());
+  resolver settings(seq, {.env_prefix = "RT_", .config_path = config});
+
+  TEST_ASSERT_EQUAL_UINT64(32, *settings.get_arg<unsigned long long>("threads"));
+  TEST_ASSERT_TRUE(settings.layer_of("threads") == resolver_layer_t::argv);
+}
+
+void test_environment_wins_over_config(void) {
+  ::setenv("RT_MAX_THREADS", "16", 1);
+  const auto config = write_config("max-threads=8\nmodel = small\n");
+  fake_argv fa{"prog", "--verbose"};
+  seq_t seq(fa.argc(), fa.argv());
+  resolver settings(seq, {.env_prefix = "RT_", .config_path = config});
+
+  TEST_ASSERT_EQUAL_UINT64(16, *settings.get_arg<unsigned long long>("max-threads"));
+  TEST_ASSERT_TRUE(settings.layer_of("max-threads") == resolver_layer_t::environment);
+  TEST_ASSERT_EQUAL_STRING("small", settings.get_arg<std::string>("model")->c_str());
+  TEST_ASSERT_TRUE(settings.layer_of("model") == resolver_layer_t::config_file);
+  TEST_ASSERT_FALSE(settings.has("missing"));
+  TEST_ASSERT_TRUE(settings.layer_of("missing") == resolver_layer_t::none);
+}
+
+void test_registered_switches_resolve_from_argv(void) {
+  const auto config = write_config("enable-cache=false\njit\n");
+  const nutsloop::args::switches_t features{{"cache", "jit", "zip"}};
+  fake_argv fa{"prog", "--enable-cache", "--disable-jit"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, features);
+  resolver settings(seq, {.env_prefix = "RT_", .config_path = config});
+
+  TEST_ASSERT_TRUE(*settings.get_arg<bool>("enable-cache"));
+  TEST_ASSERT_TRUE(settings.layer_of("enable-cache") == resolver_layer_t::argv);
+  TEST_ASSERT_FALSE(*settings.get_arg<bool>("disable-jit"));
+  TEST_ASSERT_TRUE(settings.layer_of("disable-jit") == resolver_layer_t::argv);
+  // a form the command line did not use still falls through to the layers.
+  TEST_ASSERT_TRUE(*settings.get_arg<bool>("jit"));
+  TEST_ASSERT_TRUE(settings.layer_of("jit") == resolver_layer_t::config_file);
+  TEST_ASSERT_FALSE(settings.has("zip"));
+}
+
+// ---------------------------------------------------------------------------
+// resolver -- typing rules match argv
+// ---------------------------------------------------------------------------
+
+void test_environment_values_are_typed_and_switches(void) {
+  ::setenv("RT_TIMEOUT", "250ms", 1);
+  ::setenv("RT_VERBOSE", "", 1);
+  ::setenv("RT_DISABLE_CACHE", "", 1);
+  ::setenv("RT_ZIP", "00501", 1);
+  fake_argv fa{"prog", "--a=1"};
+  // the resolver takes its typed keys from the sequencer unless given its own.
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, std::nullopt,
+            std::unordered_set<std::string>{"timeout"});
+  resolver settings(seq, {.env_prefix = "RT_",
+                          .skip_digit_check = std::unordered_set<std::string>{"zip"}});
+
+  TEST_ASSERT_TRUE(*settings.get_arg<nutsloop::args::args_duration_t>("timeout") ==
+                   std::chrono::milliseconds(250));
+  resolver untyped(seq, {.env_prefix = "RT_", .typed_keys = std::unordered_set<std::string>{}});
+  TEST_ASSERT_EQUAL_STRING("250ms", untyped.get_arg<std::string>("timeout")->c_str());
+  TEST_ASSERT_TRUE(*settings.get_arg<bool>("verbose"));
+  TEST_ASSERT_FALSE(*settings.get_arg<bool>("disable-cache"));
+  TEST_ASSERT_EQUAL_STRING("00501", settings.get_arg<std::string>("zip")->c_str());
+}
+
+void test_skip_digit_check_defaults_to_the_sequencer(void) {
+  ::setenv("RT_ZIP", "00501", 1);
+  fake_argv fa{"prog", "--a=1"};
+  seq_t seq(fa.argc(), fa.argv(), std::unordered_set<std::string>{"zip"});
+
+  resolver inherited(seq, {.env_prefix = "RT_"});
+  TEST_ASSERT_EQUAL_STRING("00501", inherited.get_arg<std::string>("zip")->c_str());
+
+  resolver overridden(seq, {.env_prefix = "RT_",
+                            .skip_digit_check = std::unordered_set<std::string>{}});
+  TEST_ASSERT_EQUAL_UINT64(501, *overridden.get_arg<unsigned long long>("zip"));
+}
+
+void test_config_file_syntax(void) {
+  const auto config = write_config("# comment\n"
+                                   "; also a comment\n"
+                                   "\n"
+                                   "  name = \"hello world\"  \r\n"
+                                   "enable-lto\n"
+                                   "disable-color\n"
+                                   "level=1\n"
+                                   "level=2\n"
+                                   "ratio=0.5");
+  fake_argv fa{"prog", "--a=1"};
+  seq_t seq(fa.argc(), fa.argv());
+  resolver settings(seq, {.config_path = config,
+                          .typed_keys = std::unordered_set<std::string>{"ratio"}});
+
+  TEST_ASSERT_EQUAL_STRING("hello world", settings.get_arg<std::string>("name")->c_str());
+  TEST_ASSERT_TRUE(*settings.get_arg<bool>("enable-lto"));
+  TEST_ASSERT_FALSE(*settings.get_arg<bool>("disable-color"));
+  TEST_ASSERT_EQUAL_UINT64(2, *settings.get_arg<unsigned long long>("level"));
+  TEST_ASSERT_EQUAL_DOUBLE(0.5, *settings.get_arg<double>("ratio"));
+}
+
+void test_type_mismatch_throws(void) {
+  const auto config = write_config("name=widget\n");
+  fake_argv fa{"prog", "--a=1"};
+  seq_t seq(fa.argc(), fa.argv());
+  resolver settings(seq, {.config_path = config});
+
+  bool caught = false;
+  try {
+    (void)settings.get_arg<unsigned long long>("name");
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for a string value");
+}
+
+// ---------------------------------------------------------------------------
+// resolver -- lazy and memoized
+// ---------------------------------------------------------------------------
+
+void test_layers_are_read_lazily_and_memoized(void) {
+  fake_argv fa{"prog", "--threads=4"};
+  seq_t seq(fa.argc(), fa.argv());
+  // the config file does not exist: nothing is opened until a lookup needs it.
+  const auto missing = (scratch_dir / "missing.conf").string();
+  resolver settings(seq, {.env_prefix = "RT_", .config_path = missing});
+
+  TEST_ASSERT_EQUAL_UINT64(4, *settings.get_arg<unsigned long long>("threads"));
+
+  ::setenv("RT_VERBOSE", "1", 1);
+  TEST_ASSERT_EQUAL_UINT64(1, *settings.get_arg<unsigned long long>("verbose"));
+  // the first result is kept even after the environment changes.
+  ::setenv("RT_VERBOSE", "2", 1);
+  TEST_ASSERT_EQUAL_UINT64(1, *settings.get_arg<unsigned long long>("verbose"));
+
+  bool caught = false;
+  try {
+    (void)settings.has("model");
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for a missing config file");
+}
@@ -0,0 +1,160 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <filesystem>
+#include <fstream>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+namespace {
+
+std::filesystem::path scratch_dir;
+
+std::string write_response_file(const std::string &name, const std::string &contents) {
+  const auto path = scratch_dir / name;
+  std::ofstream(path, std::ios::binary) << contents;
+  return path.string();
+}
+
+} // namespace
+
+void setUp(void) {
+  scratch_dir = std::filesystem::temp_directory_path() / "nutsloop_args_response_files";
+  std::filesystem::create_directories(scratch_dir);
+}
+
+void tearDown(void) { std::filesystem::remove_all(scratch_dir); }
+
+// ---------------------------------------------------------------------------
+// @file -- expansion follows the parse_ rules
+// ---------------------------------------------------------------------------
+
+void test_response_file_arguments_are_parsed(void) {
+  const auto rsp = "@" + write_response_file("args.rsp", "--verbose --port=8080\n"
+                                                          "--enable-cache --disable-safety\n"
+                                                          "--name=widget\n");
+  fake_argv fa{"prog", rsp.c_str()};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_TRUE(std::get<bool>(seq.get_args().at("verbose")));
+  TEST_ASSERT_EQUAL_UINT64(8080, std::get<unsigned long long>(seq.get_args().at("port")));
+  TEST_ASSERT_TRUE(std::get<bool>(seq.get_args().at("enable-cache")));
+  TEST_ASSERT_FALSE(std::get<bool>(seq.get_args().at("disable-safety")));
+  TEST_ASSERT_EQUAL_STRING("widget", std::get<std::string>(seq.get_args().at("name")).c_str());
+}
+
+void test_response_file_quotes_and_escapes(void) {
+  const auto rsp = "@" + write_response_file(
+                             "quotes.rsp", "--title=\"hello world\" '--path=/tmp/a b' --sep=a\\ b\n");
+  fake_argv fa{"prog", rsp.c_str()};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("hello world",
+      std::get<std::string>(seq.get_args().at("title")).c_str());
+  TEST_ASSERT_EQUAL_STRING("/tmp/a b", std::get<std::string>(seq.get_args().at("path")).c_str());
+  TEST_ASSERT_EQUAL_STRING("a b", std::get<std::string>(seq.get_args().at("sep")).c_str());
+}
+
+void test_response_file_respects_skip_digit_check(void) {
+  const auto rsp = "@" + write_response_file("digits.rsp", "--temperature=7 --count=42");
+  nutsloop::args::skip_digit_check_t skip{std::unordered_set<std::string>{"temperature"}};
+  fake_argv fa{"prog", rsp.c_str()};
+  seq_t seq(fa.argc(), fa.argv(), skip);
+
+  TEST_ASSERT_TRUE(std::holds_alternative<std::string>(seq.get_args().at("temperature")));
+  TEST_ASSERT_TRUE(std::holds_alternative<unsigned long long>(seq.get_args().at("count")));
+}
+
+void test_response_file_mixes_with_argv(void) {
+  const auto rsp = "@" + write_response_file("mixed.rsp", "--port=1");
+  fake_argv fa{"prog", "serve", "--host=a", rsp.c_str(), "--port=2"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("serve", seq.get_command().c_str());
+  TEST_ASSERT_EQUAL_STRING("a", std::get<std::string>(seq.get_args().at("host")).c_str());
+  // later values overwrite earlier ones, wherever they come from.
+  TEST_ASSERT_EQUAL_UINT64(2, std::get<unsigned long long>(seq.get_args().at("port")));
+}
+
+void test_response_file_can_supply_command(void) {
+  const auto rsp = "@" + write_response_file("command.rsp", "deploy --verbose");
+  fake_argv fa{"prog", rsp.c_str()};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("deploy", seq.get_command().c_str());
+  TEST_ASSERT_TRUE(seq.has("verbose"));
+}
+
+void test_response_file_help_stops_parsing(void) {
+  const auto rsp = "@" + write_response_file("help.rsp", "--verbose --help --debug");
+  fake_argv fa{"prog", rsp.c_str(), "--after"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_TRUE(seq.has("verbose"));
+  TEST_ASSERT_TRUE(seq.has("help"));
+  TEST_ASSERT_FALSE(seq.has("debug"));
+  TEST_ASSERT_FALSE(seq.has("after"));
+}
+
+// ---------------------------------------------------------------------------
+// @file -- nesting and cycles
+// ---------------------------------------------------------------------------
+
+void test_nested_response_files(void) {
+  const auto inner = write_response_file("inner.rsp", "--depth=2");
+  const auto outer = "@" + write_response_file("outer.rsp", "--depth=1 --outer @" + inner);
+  fake_argv fa{"prog", outer.c_str()};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_TRUE(seq.has("outer"));
+  TEST_ASSERT_EQUAL_UINT64(2, std::get<unsigned long long>(seq.get_args().at("depth")));
+}
+
+void test_response_file_cycle_throws(void) {
+  const auto a = (scratch_dir / "a.rsp").string();
+  const auto b = (scratch_dir / "b.rsp").string();
+  write_response_file("a.rsp", "--a @" + b);
+  write_response_file("b.rsp", "--b @" + a);
+
+  const auto rsp = "@" + a;
+  fake_argv fa{"prog", rsp.c_str()};
+  bool caught = false;
+  try {
+    seq_t seq(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for a response file cycle");
+}
+
+void test_missing_response_file_is_literal(void) {
+  fake_argv fa{"prog", "@no-such-file.rsp", "--verbose"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("@no-such-file.rsp", seq.get_command().c_str());
+  TEST_ASSERT_TRUE(seq.has("verbose"));
+}
+
+void test_unterminated_quote_throws(void) {
+  const auto rsp = "@" + write_response_file("broken.rsp", "--name=\"open");
+  fake_argv fa{"prog", rsp.c_str()};
+  bool caught = false;
+  try {
+    seq_t seq(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for an unterminated quote");
+}
+
+void test_response_file_help_stops_before_later_request(void) {
+  const auto rsp = "@" + write_response_file("help.rsp", "--port=80 --?build --verbose\n");
+  fake_argv fa{"prog", rsp.c_str(), "--version"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("build", std::get<std::string>(seq.get_args().at("help")).c_str());
+  TEST_ASSERT_TRUE(seq.has("port"));
+  TEST_ASSERT_FALSE(seq.has("verbose"));
+  TEST_ASSERT_FALSE(seq.has("version"));
+}
@@ -0,0 +1,148 @@
+#include "args/schema.h++"
+#include "test_types.h++"
+#include "unity.h"
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+
+using nutsloop::args::option_t;
+
+using schema_t = nutsloop::args::schema_sequencer<
+    option_t<"threads", unsigned long long, "t", 4>,
+    option_t<"model", std::string, "m", "default">,
+    option_t<"verbose", bool>,
+    option_t<"disable-cache", bool>,
+    option_t<"endpoint", std::string>>;
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// perfect hash -- compile-time key table
+// ---------------------------------------------------------------------------
+
+void test_perfect_hash_finds_every_key(void) {
+  constexpr std::array<std::string_view, 5> keys{"threads", "model", "verbose", "t", "m"};
+  constexpr auto table = nutsloop::args::make_perfect_hash<keys.size()>(keys);
+
+  static_assert(table.find("threads") == 0);
+  static_assert(table.find("m") == 4);
+  static_assert(table.find("missing") == decltype(table)::npos);
+
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    TEST_ASSERT_EQUAL_UINT64(i, table.find(keys[i]));
+  }
+}
+
+void test_schema_is_option_resolves_names_and_aliases(void) {
+  static_assert(schema_t::is_option("threads"));
+  static_assert(schema_t::is_option("t"));
+  static_assert(!schema_t::is_option("x"));
+  TEST_ASSERT_TRUE(schema_t::is_option("m"));
+}
+
+// ---------------------------------------------------------------------------
+// schema_sequencer -- typed values and defaults
+// ---------------------------------------------------------------------------
+
+void test_schema_defaults_when_not_passed(void) {
+  fake_argv fa{"prog", "--verbose"};
+  schema_t parser(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_UINT64(4, parser.get<"threads">());
+  TEST_ASSERT_EQUAL_STRING("default", parser.get<"model">().c_str());
+  TEST_ASSERT_FALSE(parser.has<"threads">());
+  TEST_ASSERT_FALSE(parser.get<"endpoint">().has_value());
+}
+
+void test_schema_long_names_and_aliases(void) {
+  fake_argv fa{"prog", "serve", "-t=16", "--model=claude", "--endpoint=/v1"};
+  schema_t parser(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("serve", parser.get_command().c_str());
+  TEST_ASSERT_EQUAL_UINT64(16, parser.get<"threads">());
+  TEST_ASSERT_EQUAL_UINT64(16, parser.get<"t">());
+  TEST_ASSERT_EQUAL_STRING("claude", parser.get<"m">().c_str());
+  TEST_ASSERT_EQUAL_STRING("/v1", parser.get<"endpoint">()->c_str());
+  TEST_ASSERT_TRUE(parser.has<"threads">());
+  TEST_ASSERT_TRUE(parser.has("model"));
+}
+
+void test_schema_switches(void) {
+  fake_argv fa{"prog", "--verbose", "--disable-cache"};
+  schema_t parser(fa.argc(), fa.argv());
+
+  TEST_ASSERT_TRUE(*parser.get<"verbose">());
+  TEST_ASSERT_FALSE(*parser.get<"disable-cache">());
+}
+
+void test_schema_get_arg_matches_sequencer_shape(void) {
+  fake_argv fa{"prog", "--threads=2"};
+  schema_t parser(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_UINT64(2, *(parser.get_arg<"threads", unsigned long long>()));
+  TEST_ASSERT_FALSE((parser.get_arg<"endpoint", std::string>().has_value()));
+}
+
+void test_schema_help_and_version_stop_parsing(void) {
+  fake_argv help{"prog", "--?model", "--threads=2"};
+  schema_t help_parser(help.argc(), help.argv());
+  TEST_ASSERT_EQUAL_STRING("model", help_parser.get_help_topic()->c_str());
+  TEST_ASSERT_FALSE(help_parser.has<"threads">());
+
+  fake_argv version{"prog", "--version"};
+  schema_t version_parser(version.argc(), version.argv());
+  TEST_ASSERT_TRUE(version_parser.get_version().has_value());
+}
+
+// ---------------------------------------------------------------------------
+// schema_sequencer -- runtime errors left for argv contents
+// ---------------------------------------------------------------------------
+
+void test_schema_unknown_key_throws(void) {
+  fake_argv fa{"prog", "--nope=1"};
+  bool caught = false;
+  try {
+    schema_t parser(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for unknown key");
+}
+
+void test_schema_non_numeric_value_throws(void) {
+  fake_argv fa{"prog", "--threads=many"};
+  bool caught = false;
+  try {
+    schema_t parser(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for non-numeric value");
+}
+
+void test_schema_switch_with_value_throws(void) {
+  fake_argv fa{"prog", "--verbose=yes"};
+  bool caught = false;
+  try {
+    schema_t parser(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for switch with value");
+}
+
+void test_schema_missing_value_throws(void) {
+  fake_argv fa{"prog", "--model"};
+  bool caught = false;
+  try {
+    schema_t parser(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument for missing value");
+}
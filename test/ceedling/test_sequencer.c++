@@ -237,7 +237,7 @@ void test_version_short_v(void) {
 }
 
 void test_version_custom_number(void) {
-  nutsloop::args::version_opt_t ver{std::array<int, 3>{2, 5, 13}};
+  nutsloop::args::version_opt_t ver{std::array<int, 4>{2, 5, 13, 0}};
   fake_argv fa{"prog", "--version"};
   seq_t seq(fa.argc(), fa.argv(), std::nullopt, ver);
 
@@ -428,3 +428,66 @@ void test_mixed_flags_values_switches_command(void) {
   TEST_ASSERT_FALSE(std::get<bool>(seq.get_args().at("disable-logging")));
   TEST_ASSERT_EQUAL_UINT(5, seq.get_args().size());
 }
+
+// ---------------------------------------------------------------------------
+// parse policy -- synchronous default and threaded opt-in
+// ---------------------------------------------------------------------------
+
+void test_threaded_policy_parses_like_sync(void) {
+  fake_argv fa{"prog", "serve", "--verbose", "--port=8080", "--host=localhost"};
+  seq_t sync(fa.argc(), fa.argv());
+  seq_threaded_t threaded(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING(sync.get_command().c_str(), threaded.get_command().c_str());
+  TEST_ASSERT_TRUE(sync.get_args() == threaded.get_args());
+}
+
+void test_sync_policy_propagates_parse_error(void) {
+  fake_argv fa{"prog", "run", "stray"};
+  bool caught = false;
+  try {
+    seq_t seq(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument from sync parse");
+}
+
+void test_threaded_policy_propagates_parse_error(void) {
+  fake_argv fa{"prog", "run", "stray"};
+  bool caught = false;
+  try {
+    seq_threaded_t seq(fa.argc(), fa.argv());
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::invalid_argument from threaded parse");
+}
+
+// ---------------------------------------------------------------------------
+// parse_ -- tokens are views over argv, stored values are owned
+// ---------------------------------------------------------------------------
+
+void test_stored_values_outlive_argv_storage(void) {
+  auto fa = std::make_unique<fake_argv>(
+      std::initializer_list<const char *>{"prog", "build", "--define-name=widget", "--jobs=8",
+                                          "--enable-lto"});
+  seq_t seq(fa->argc(), fa->argv());
+  fa.reset();
+
+  TEST_ASSERT_EQUAL_STRING("build", seq.get_command().c_str());
+  TEST_ASSERT_EQUAL_STRING("widget",
+      std::get<std::string>(seq.get_args().at("define-name")).c_str());
+  TEST_ASSERT_EQUAL_UINT64(8, std::get<unsigned long long>(seq.get_args().at("jobs")));
+  TEST_ASSERT_TRUE(std::get<bool>(seq.get_args().at("enable-lto")));
+}
+
+void test_ull_max_boundary_stays_numeric(void) {
+  fake_argv fa{"prog", "--max=18446744073709551615", "--over=18446744073709551616"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_UINT64(18446744073709551615ULL,
+      std::get<unsigned long long>(seq.get_args().at("max")));
+  TEST_ASSERT_EQUAL_STRING("18446744073709551616",
+      std::get<std::string>(seq.get_args().at("over")).c_str());
+}
@@ -0,0 +1,184 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <unordered_set>
+#include <vector>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+using namespace std::chrono_literals;
+using nutsloop::args::args_duration_t;
+using nutsloop::args::args_size_t;
+using nutsloop::args::snapshot_view_t;
+
+namespace {
+
+template <typename Fn> bool throws_invalid_argument(Fn &&fn) {
+  try {
+    fn();
+  } catch (const std::invalid_argument &) {
+    return true;
+  }
+  return false;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// sequencer::snapshot() -> snapshot_view_t
+// ---------------------------------------------------------------------------
+
+void test_snapshot_round_trips_typed_values_and_command(void) {
+  fake_argv fa{"prog",         "serve",         "--name=widget", "--port=8080", "--offset=-42",
+               "--ratio=0.75", "--timeout=250ms", "--buffer=64KiB", "--verbose"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, std::nullopt,
+            std::unordered_set<std::string>{"offset", "ratio", "timeout", "buffer"});
+
+  const auto blob = seq.snapshot();
+  const snapshot_view_t view(blob);
+
+  TEST_ASSERT_EQUAL_STRING("serve", std::string(view.get_command()).c_str());
+  TEST_ASSERT_EQUAL_UINT64(seq.get_args().size(), view.size());
+  TEST_ASSERT_EQUAL_STRING("widget", view.get_arg<std::string>("name")->c_str());
+  TEST_ASSERT_TRUE(view.get_view("name") == "widget");
+  TEST_ASSERT_EQUAL_UINT64(8080, *view.get_arg<unsigned long long>("port"));
+  TEST_ASSERT_EQUAL_INT64(-42, *view.get_arg<long long>("offset"));
+  TEST_ASSERT_EQUAL_DOUBLE(0.75, *view.get_arg<double>("ratio"));
+  TEST_ASSERT_TRUE(*view.get_arg<args_duration_t>("timeout") == 250ms);
+  TEST_ASSERT_EQUAL_UINT64(64ULL * 1024, view.get_arg<args_size_t>("buffer")->bytes);
+  TEST_ASSERT_TRUE(*view.get_arg<bool>("verbose"));
+  TEST_ASSERT_FALSE(view.has("missing"));
+  TEST_ASSERT_FALSE(view.get_arg<std::string>("missing").has_value());
+
+  for (std::size_t i = 1; i < view.size(); ++i) {
+    TEST_ASSERT_TRUE(view.key(i - 1) < view.key(i));
+  }
+}
+
+void test_snapshot_keeps_registered_switches(void) {
+  fake_argv fa{"prog", "--enable-cache", "--disable-color", "--jit"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::unordered_set<std::string>{},
+            std::vector<std::string>{"cache", "color", "jit", "unused"});
+
+  const auto blob = seq.snapshot();
+  const snapshot_view_t view(blob);
+
+  for (const char *key : {"enable-cache", "disable-color", "jit"}) {
+    TEST_ASSERT_TRUE_MESSAGE(view.get_arg<bool>(key) == seq.get_arg<bool>(key), key);
+  }
+  TEST_ASSERT_TRUE(*view.get_arg<bool>("enable-cache"));
+  TEST_ASSERT_FALSE(*view.get_arg<bool>("disable-color"));
+  TEST_ASSERT_FALSE(view.has("unused"));
+  TEST_ASSERT_FALSE(view.has("enable-unused"));
+}
+
+void test_snapshot_into_short_buffer_writes_nothing(void) {
+  fake_argv fa{"prog", "--name=widget", "--port=8080"};
+  seq_pmr_t seq(fa.argc(), fa.argv());
+
+  std::vector<std::byte> buffer(16, std::byte{0x5a});
+  const auto size = seq.snapshot(buffer);
+  TEST_ASSERT_EQUAL_UINT64(seq.snapshot().size(), size);
+  TEST_ASSERT_TRUE(size > buffer.size());
+  for (const auto byte : buffer) {
+    TEST_ASSERT_TRUE(byte == std::byte{0x5a});
+  }
+
+  // a mapping rounded up to whole pages is longer than the snapshot.
+  buffer.resize(size + 100);
+  TEST_ASSERT_EQUAL_UINT64(size, seq.snapshot(buffer));
+  const snapshot_view_t view(buffer);
+  TEST_ASSERT_EQUAL_UINT64(8080, *view.get_arg<unsigned long long>("port"));
+}
+
+void test_snapshot_view_rejects_invalid_blobs(void) {
+  fake_argv fa{"prog", "--name=widget", "--port=8080"};
+  seq_t seq(fa.argc(), fa.argv());
+  const auto blob = seq.snapshot();
+
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { snapshot_view_t{std::span(blob).first(8)}; }));
+  TEST_ASSERT_TRUE(
+      throws_invalid_argument([&] { snapshot_view_t{std::span(blob).first(blob.size() - 1)}; }));
+
+  auto bad_magic = blob;
+  bad_magic[0] = std::byte{'X'};
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { snapshot_view_t{bad_magic}; }));
+
+  // format version sits right after the 8-byte magic.
+  auto bad_format = blob;
+  bad_format[8] = std::byte{0x7f};
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { snapshot_view_t{bad_format}; }));
+
+  // first entry's key offset, pointing past the end of the blob.
+  auto bad_offset = blob;
+  bad_offset[40 + 3] = std::byte{0x7f};
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { snapshot_view_t{bad_offset}; }));
+}
+
+void test_snapshot_view_rejects_forged_string_offsets(void) {
+  fake_argv fa{"prog", "--name=widget"};
+  seq_t seq(fa.argc(), fa.argv());
+  const auto blob = seq.snapshot();
+
+  // the only entry is a string: its payload follows key_offset and key_size.
+  const auto forge = [&blob](const std::uint64_t payload, const std::uint32_t size) {
+    auto forged = blob;
+    std::memcpy(forged.data() + 40 + 8, &payload, sizeof(payload));
+    std::memcpy(forged.data() + 40 + 16, &size, sizeof(size));
+    return forged;
+  };
+
+  // offset + size wraps around to 0 in 64 bits.
+  const auto wrapping = forge(~std::uint64_t{0}, 1);
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { snapshot_view_t{wrapping}; }));
+  const auto wide = forge(std::uint64_t{1} << 32, 0);
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { snapshot_view_t{wide}; }));
+  const auto past_end = forge(blob.size(), 1);
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { snapshot_view_t{past_end}; }));
+}
+
+void test_snapshot_view_type_mismatch_throws(void) {
+  fake_argv fa{"prog", "--name=widget", "--port=8080"};
+  seq_t seq(fa.argc(), fa.argv());
+  const auto blob = seq.snapshot();
+  const snapshot_view_t view(blob);
+
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { (void)view.get_arg<std::string>("port"); }));
+  TEST_ASSERT_TRUE(
+      throws_invalid_argument([&] { (void)view.get_arg<unsigned long long>("name"); }));
+  TEST_ASSERT_TRUE(throws_invalid_argument([&] { (void)view.get_view("port"); }));
+}
+
+void test_snapshot_view_over_mapped_file(void) {
+  fake_argv fa{"prog", "deploy", "--region=eu-west", "--replicas=3", "--dry-run"};
+  seq_t seq(fa.argc(), fa.argv());
+  const auto blob = seq.snapshot();
+
+  std::FILE *file = std::tmpfile();
+  TEST_ASSERT_NOT_NULL(file);
+  TEST_ASSERT_EQUAL_UINT64(blob.size(), std::fwrite(blob.data(), 1, blob.size(), file));
+  std::fflush(file);
+
+  auto mapped = nutsloop::args::mapped_file_t::map(fileno(file));
+  std::fclose(file);
+  TEST_ASSERT_TRUE(mapped.has_value());
+
+  const snapshot_view_t view(std::as_bytes(mapped->data()));
+  TEST_ASSERT_EQUAL_STRING("deploy", std::string(view.get_command()).c_str());
+  TEST_ASSERT_TRUE(view.get_view("region") == "eu-west");
+  TEST_ASSERT_EQUAL_UINT64(3, *view.get_arg<unsigned long long>("replicas"));
+  TEST_ASSERT_TRUE(*view.get_arg<bool>("dry-run"));
+}
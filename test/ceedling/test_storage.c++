@@ -0,0 +1,89 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include <format>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ---------------------------------------------------------------------------
+// args_flat_t -- map-like surface
+// ---------------------------------------------------------------------------
+
+void test_flat_insert_find_and_overwrite(void) {
+  nutsloop::args::args_flat_t flat;
+  flat["port"] = 8080ULL;
+  flat["host"] = std::string("localhost");
+  flat["port"] = 9090ULL;
+
+  TEST_ASSERT_EQUAL_UINT(2, flat.size());
+  TEST_ASSERT_TRUE(flat.contains("host"));
+  TEST_ASSERT_FALSE(flat.contains("missing"));
+  TEST_ASSERT_TRUE(flat.find("missing") == flat.end());
+  TEST_ASSERT_EQUAL_UINT64(9090, std::get<unsigned long long>(flat.at("port")));
+}
+
+void test_flat_at_missing_key_throws(void) {
+  const nutsloop::args::args_flat_t flat;
+  bool caught = false;
+  try {
+    (void)flat.at("missing");
+  } catch (const std::out_of_range &) {
+    caught = true;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(caught, "expected std::out_of_range for missing key");
+}
+
+void test_flat_survives_growth(void) {
+  nutsloop::args::args_flat_t flat;
+  for (unsigned long long i = 0; i < 5000; ++i) {
+    flat[std::format("key-{}", i)] = i;
+  }
+
+  TEST_ASSERT_EQUAL_UINT(5000, flat.size());
+  for (unsigned long long i = 0; i < 5000; ++i) {
+    TEST_ASSERT_EQUAL_UINT64(i, std::get<unsigned long long>(flat.at(std::format("key-{}", i))));
+  }
+}
+
+void test_flat_equality_ignores_insertion_order(void) {
+  nutsloop::args::args_flat_t lhs;
+  nutsloop::args::args_flat_t rhs;
+  lhs["a"] = true;
+  lhs["b"] = 1ULL;
+  rhs["b"] = 1ULL;
+  rhs["a"] = true;
+
+  TEST_ASSERT_TRUE(lhs == rhs);
+  rhs["a"] = false;
+  TEST_ASSERT_FALSE(lhs == rhs);
+}
+
+// ---------------------------------------------------------------------------
+// sequencer -- flat storage policy
+// ---------------------------------------------------------------------------
+
+void test_flat_sequencer_parses_like_default(void) {
+  fake_argv fa{"prog", "serve", "--verbose", "--port=8080", "--enable-ssl", "--host=localhost"};
+  seq_flat_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("serve", seq.get_command().c_str());
+  TEST_ASSERT_EQUAL_UINT(4, seq.get_args().size());
+  TEST_ASSERT_TRUE(seq.has("verbose"));
+  TEST_ASSERT_EQUAL_UINT64(8080, *seq.get_arg<unsigned long long>("port"));
+  TEST_ASSERT_EQUAL_STRING("localhost",
+      std::get<std::string>(seq.get_option_string("host").value).c_str());
+}
+
+void test_flat_sequencer_get_some_args(void) {
+  fake_argv fa{"prog", "--a=1", "--b=2", "--c=3"};
+  seq_flat_t seq(fa.argc(), fa.argv());
+
+  auto some = seq.get_some_args({"a", "c", "missing"});
+  TEST_ASSERT_EQUAL_UINT(2, some.size());
+  TEST_ASSERT_TRUE(some.contains("a"));
+  TEST_ASSERT_FALSE(some.contains("b"));
+}
@@ -0,0 +1,135 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include "args/error.h++"
+
+#include <format>
+#include <string>
+#include <vector>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+
+const nutsloop::args::switches_t features{{"cache", "color", "jit"}};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// registered switches
+// ---------------------------------------------------------------------------
+
+void test_switches_set_bits_for_each_form(void) {
+  fake_argv fa{"prog", "--enable-cache", "--disable-color", "--jit", "--other"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, features);
+
+  const auto &switches = seq.switches();
+  TEST_ASSERT_EQUAL_UINT64(3, switches.size());
+  TEST_ASSERT_TRUE(switches.test(switches.index("cache")));
+  TEST_ASSERT_FALSE(switches.test(switches.index("color")));
+  TEST_ASSERT_TRUE(switches.test(switches.index("jit")));
+  TEST_ASSERT_EQUAL_UINT64(2, switches.count());
+
+  // only the unregistered switch is stored as an argument.
+  TEST_ASSERT_EQUAL_UINT64(1, seq.get_args().size());
+  TEST_ASSERT_TRUE(seq.has("other"));
+}
+
+void test_switches_keep_get_option_bool_semantics(void) {
+  fake_argv fa{"prog", "--enable-cache", "--disable-color", "--jit"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, features);
+
+  TEST_ASSERT_TRUE(std::get<bool>(seq.get_option_bool("enable-cache").value));
+  TEST_ASSERT_FALSE(std::get<bool>(seq.get_option_bool("disable-color").value));
+  TEST_ASSERT_TRUE(std::get<bool>(seq.get_option_bool("jit").value));
+  TEST_ASSERT_TRUE(
+      std::holds_alternative<std::nullptr_t>(seq.get_option_bool("enable-color").value));
+  TEST_ASSERT_TRUE(seq.has("disable-color"));
+  TEST_ASSERT_FALSE(seq.has("cache"));
+  TEST_ASSERT_TRUE(seq.get_arg<bool>("enable-cache").value());
+  TEST_ASSERT_TRUE(seq.get_arg<bool>(seq.key("jit")).value());
+}
+
+void test_switches_in_get_some_args(void) {
+  fake_argv fa{"prog", "--enable-cache", "--name=widget"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, features);
+
+  const auto some = seq.get_some_args({"enable-cache", "name", "jit"});
+  TEST_ASSERT_EQUAL_UINT64(2, some.size());
+  TEST_ASSERT_TRUE(std::get<bool>(some.at("enable-cache")));
+}
+
+void test_switches_enable_and_disable_conflict(void) {
+  fake_argv fa{"prog", "--enable-cache", "--disable-cache"};
+  bool threw = false;
+  try {
+    seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, features);
+  } catch (const nutsloop::args::error &e) {
+    threw = true;
+    TEST_ASSERT_EQUAL_STRING("--disable-cache has conflict with --enable-cache", e.what());
+  }
+  TEST_ASSERT_TRUE(threw);
+}
+
+void test_switches_mask_queries(void) {
+  fake_argv fa{"prog", "--enable-cache", "--jit"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, features);
+  const auto &switches = seq.switches();
+
+  TEST_ASSERT_TRUE(switches.all(switches.mask({"cache", "jit"})));
+  TEST_ASSERT_FALSE(switches.all(switches.mask({"cache", "color"})));
+  TEST_ASSERT_TRUE(switches.any(switches.mask({"cache", "color"})));
+  TEST_ASSERT_TRUE(switches.none(switches.mask({"color"})));
+
+  bool threw = false;
+  try {
+    (void)switches.mask({"unknown"});
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  TEST_ASSERT_TRUE(threw);
+}
+
+void test_switches_iterate_and_snapshot_many_words(void) {
+  std::vector<std::string> names;
+  std::vector<std::string> args{"prog"};
+  for (int i = 0; i < 500; ++i) {
+    names.push_back(std::format("feature-{}", i));
+    args.push_back(std::format(i % 7 == 0 ? "--enable-feature-{}" : "--disable-feature-{}", i));
+  }
+  std::vector<char *> argv;
+  for (auto &arg : args) {
+    argv.push_back(arg.data());
+  }
+  seq_flat_t seq(static_cast<int>(argv.size()), argv.data(), std::nullopt, std::nullopt,
+                 std::nullopt, names);
+
+  std::vector<std::size_t> enabled;
+  seq.switches().for_each_enabled([&](const std::size_t bit) { enabled.push_back(bit); });
+  TEST_ASSERT_EQUAL_UINT64(72, enabled.size());
+  TEST_ASSERT_EQUAL_UINT64(0, enabled.front());
+  TEST_ASSERT_EQUAL_UINT64(497, enabled.back());
+  TEST_ASSERT_EQUAL_STRING("feature-497", std::string(seq.switches().name(497)).c_str());
+
+  const auto snapshot = seq.switches().snapshot();
+  TEST_ASSERT_EQUAL_UINT64(8, snapshot.size());
+  TEST_ASSERT_EQUAL_UINT64(0, seq.get_args().size());
+}
+
+void test_switches_cleared_by_reparse(void) {
+  seq_t seq(std::nullopt, std::nullopt, std::nullopt, features);
+  fake_argv first{"prog", "--enable-cache"};
+  seq.parse(first.argc(), first.argv());
+  TEST_ASSERT_TRUE(seq.has("enable-cache"));
+
+  // a conflict is only between switches of the same command line.
+  fake_argv second{"prog", "--disable-cache"};
+  seq.parse(second.argc(), second.argv());
+  TEST_ASSERT_FALSE(seq.has("enable-cache"));
+  TEST_ASSERT_FALSE(seq.switches().test(0));
+  TEST_ASSERT_EQUAL_UINT64(3, seq.switches().size());
+}
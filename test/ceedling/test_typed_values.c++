@@ -0,0 +1,168 @@
+#include "test_types.h++"
+#include "unity.h"
+
+#include "args/schema.h++"
+
+#include <chrono>
+#include <string>
+#include <unordered_set>
+
+TEST_SOURCE_FILE("src/args/args_stub.c++")
+TEST_SOURCE_FILE("src/args/args_gcov_inst.c++")
+
+void setUp(void) {}
+void tearDown(void) {}
+
+using nutsloop::args::args_duration_t;
+using nutsloop::args::args_size_t;
+using nutsloop::args::option_t;
+using namespace std::chrono_literals;
+
+namespace {
+
+const nutsloop::args::typed_keys_t typed{std::unordered_set<std::string>{
+    "offset", "ratio", "scale", "timeout", "retry", "ttl", "tick", "buffer", "heap", "disk",
+    "block", "range", "big", "id", "low", "delay"}};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// sequencer -- values are inferred and stored unboxed
+// ---------------------------------------------------------------------------
+
+void test_signed_and_floating_values(void) {
+  fake_argv fa{"prog", "--offset=-42", "--ratio=0.75", "--scale=-1.5e3", "--port=8080"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, std::nullopt, typed);
+
+  TEST_ASSERT_EQUAL_INT64(-42, *seq.get_arg<long long>("offset"));
+  TEST_ASSERT_EQUAL_DOUBLE(0.75, *seq.get_arg<double>("ratio"));
+  TEST_ASSERT_EQUAL_DOUBLE(-1500.0, *seq.get_arg<double>("scale"));
+  TEST_ASSERT_EQUAL_UINT64(8080, *seq.get_arg<unsigned long long>("port"));
+}
+
+void test_duration_values(void) {
+  fake_argv fa{"prog", "--timeout=250ms", "--retry=5s", "--ttl=2h", "--tick=10us"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, std::nullopt, typed);
+
+  TEST_ASSERT_TRUE(*seq.get_arg<args_duration_t>("timeout") == 250ms);
+  TEST_ASSERT_TRUE(*seq.get_arg<args_duration_t>("retry") == 5s);
+  TEST_ASSERT_TRUE(*seq.get_arg<args_duration_t>("ttl") == 2h);
+  TEST_ASSERT_TRUE(*seq.get_arg<args_duration_t>("tick") == 10us);
+}
+
+void test_size_values(void) {
+  fake_argv fa{"prog", "--buffer=64KiB", "--heap=2G", "--disk=10MB", "--block=512B"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, std::nullopt, typed);
+
+  TEST_ASSERT_EQUAL_UINT64(64ULL * 1024, seq.get_arg<args_size_t>("buffer")->bytes);
+  TEST_ASSERT_EQUAL_UINT64(2ULL * 1024 * 1024 * 1024, seq.get_arg<args_size_t>("heap")->bytes);
+  TEST_ASSERT_EQUAL_UINT64(10000000ULL, seq.get_arg<args_size_t>("disk")->bytes);
+  TEST_ASSERT_EQUAL_UINT64(512, seq.get_arg<args_size_t>("block")->bytes);
+}
+
+void test_lookalikes_stay_strings(void) {
+  fake_argv fa{"prog", "--name=5x", "--mode=inf", "--level=nan", "--range=-5ms",
+               "--big=99999999999999999999h", "--id=-", "--low=-99999999999999999999"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, std::nullopt, typed);
+
+  for (const char *key : {"name", "mode", "level", "range", "big", "id", "low"}) {
+    TEST_ASSERT_TRUE_MESSAGE(seq.get_arg<std::string>(key).has_value(), key);
+  }
+}
+
+void test_untyped_keys_keep_signed_and_floating_text(void) {
+  fake_argv fa{"prog", "--ratio=1.10", "--tz=-0500", "--x=12e3", "--port=8080"};
+  seq_t seq(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_STRING("1.10", seq.get_arg<std::string>("ratio")->c_str());
+  TEST_ASSERT_EQUAL_STRING("-0500", seq.get_arg<std::string>("tz")->c_str());
+  TEST_ASSERT_EQUAL_STRING("12e3", seq.get_arg<std::string>("x")->c_str());
+  // unsigned integers are typed for every key, as before.
+  TEST_ASSERT_EQUAL_UINT64(8080, *seq.get_arg<unsigned long long>("port"));
+}
+
+void test_units_only_for_typed_keys(void) {
+  fake_argv fa{"prog", "--timeout=250ms", "--label=5s", "--tag=64KiB", "--count=3"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, std::nullopt, typed);
+
+  TEST_ASSERT_TRUE(*seq.get_arg<args_duration_t>("timeout") == 250ms);
+  TEST_ASSERT_EQUAL_STRING("5s", seq.get_arg<std::string>("label")->c_str());
+  TEST_ASSERT_EQUAL_STRING("64KiB", seq.get_arg<std::string>("tag")->c_str());
+  TEST_ASSERT_EQUAL_UINT64(3, *seq.get_arg<unsigned long long>("count"));
+
+  // without typed_keys every value with a unit stays a string.
+  seq_t plain(fa.argc(), fa.argv());
+  TEST_ASSERT_EQUAL_STRING("250ms", plain.get_arg<std::string>("timeout")->c_str());
+}
+
+void test_skip_digit_check_keeps_typed_forms_as_strings(void) {
+  nutsloop::args::skip_digit_check_t skip{std::unordered_set<std::string>{"label", "delta"}};
+  fake_argv fa{"prog", "--label=5s", "--delta=-1"};
+  // skip_digit_check wins over typed_keys.
+  seq_t seq(fa.argc(), fa.argv(), skip, std::nullopt, std::nullopt, std::nullopt,
+            std::unordered_set<std::string>{"label", "delta"});
+
+  TEST_ASSERT_EQUAL_STRING("5s", seq.get_arg<std::string>("label")->c_str());
+  TEST_ASSERT_EQUAL_STRING("-1", seq.get_arg<std::string>("delta")->c_str());
+}
+
+void test_get_arg_type_mismatch_names_the_type(void) {
+  fake_argv fa{"prog", "--timeout=250ms"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt, std::nullopt, std::nullopt, typed);
+
+  try {
+    (void)seq.get_arg<double>("timeout");
+    TEST_FAIL_MESSAGE("expected std::invalid_argument");
+  } catch (const std::invalid_argument &e) {
+    TEST_ASSERT_EQUAL_STRING("--timeout accept only double", e.what());
+  }
+}
+
+void test_get_all_typed_values(void) {
+  fake_argv fa{"prog", "--delay=1s,250ms", "--delay=2m"};
+  seq_t seq(fa.argc(), fa.argv(), std::nullopt, std::nullopt,
+            std::unordered_set<std::string>{"delay"}, std::nullopt, typed);
+
+  const auto delays = seq.get_all<args_duration_t>("delay");
+  TEST_ASSERT_EQUAL_UINT(3, delays.size());
+  TEST_ASSERT_TRUE(delays[1] == 250ms);
+  TEST_ASSERT_TRUE(delays[2] == 2min);
+}
+
+// ---------------------------------------------------------------------------
+// schema_sequencer -- declared types and defaults
+// ---------------------------------------------------------------------------
+
+using typed_cli = nutsloop::args::schema_sequencer<
+    option_t<"offset", long long, "o", -1>, option_t<"ratio", double, "", 0.5>,
+    option_t<"timeout", args_duration_t, "t", "30s">, option_t<"buffer", args_size_t, "", "4KiB">,
+    option_t<"level", long long>>;
+
+void test_schema_typed_defaults(void) {
+  fake_argv fa{"prog", "--level=7"};
+  typed_cli cli(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_INT64(-1, cli.get<"offset">());
+  TEST_ASSERT_EQUAL_DOUBLE(0.5, cli.get<"ratio">());
+  TEST_ASSERT_TRUE(cli.get<"timeout">() == 30s);
+  TEST_ASSERT_EQUAL_UINT64(4096, cli.get<"buffer">().bytes);
+  TEST_ASSERT_EQUAL_INT64(7, *cli.get<"level">());
+}
+
+void test_schema_typed_values_and_errors(void) {
+  fake_argv fa{"prog", "-o=12", "--ratio=2", "-t=100ms", "--buffer=1024"};
+  typed_cli cli(fa.argc(), fa.argv());
+
+  TEST_ASSERT_EQUAL_INT64(12, cli.get<"offset">());
+  TEST_ASSERT_EQUAL_DOUBLE(2.0, cli.get<"ratio">());
+  TEST_ASSERT_TRUE(cli.get<"timeout">() == 100ms);
+  TEST_ASSERT_EQUAL_UINT64(1024, cli.get<"buffer">().bytes);
+
+  fake_argv bad{"prog", "--timeout=soon"};
+  try {
+    typed_cli rejected(bad.argc(), bad.argv());
+    TEST_FAIL_MESSAGE("expected std::invalid_argument");
+  } catch (const std::invalid_argument &e) {
+    TEST_ASSERT_EQUAL_STRING("--timeout accept only duration.", e.what());
+  }
+}
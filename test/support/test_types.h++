@@ -1,6 +1,7 @@
 #pragma once
 
 #include "args.h++"
+#include <memory>
 #include <vector>
 
 // ---------------------------------------------------------------------------
@@ -18,8 +19,8 @@ struct test_checker {
 
 struct test_helper {
   std::string look_up;
-  std::array<int, 3> ver;
-  test_helper(std::string s, std::array<int, 3> v) : look_up(std::move(s)), ver(v) {}
+  std::array<int, 4> ver;
+  test_helper(std::string s, std::array<int, 4> v) : look_up(std::move(s)), ver(v) {}
 };
 
 // ---------------------------------------------------------------------------
@@ -28,6 +29,15 @@ struct test_helper {
 
 using seq_t = nutsloop::args::sequencer<test_checker>;
 using seq_help_t = nutsloop::args::sequencer<test_checker, test_helper>;
+using seq_threaded_t =
+    nutsloop::args::sequencer<test_checker, bool, nutsloop::args::parse_threaded_t>;
+using seq_flat_t = nutsloop::args::sequencer<test_checker, bool, nutsloop::args::parse_sync_t,
+                                             nutsloop::args::args_flat_t>;
+using seq_pmr_t = nutsloop::args::sequencer<test_checker, bool, nutsloop::args::parse_sync_t,
+                                            nutsloop::args::pmr::args_t>;
+using seq_stats_t =
+    nutsloop::args::sequencer<test_checker, bool, nutsloop::args::parse_sync_t,
+                              nutsloop::args::pmr::args_t, nutsloop::args::instrumented_t>;
 
 // ---------------------------------------------------------------------------
 // Helper: build argc/argv from initializer list